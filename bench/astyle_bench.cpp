@@ -0,0 +1,510 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   astyle_bench.cpp
+ *
+ *   Copyright (C) 2014 by Jim Pattee
+ *   <http://www.gnu.org/licenses/lgpl-3.0.html>
+ *
+ *   This file is a part of Artistic Style - an indentation and
+ *   reformatting tool for C, C++, C# and Java source files.
+ *   <http://astyle.sourceforge.net>
+ *
+ *   Artistic Style is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU Lesser General Public License as published
+ *   by the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Artistic Style is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public License
+ *   along with Artistic Style.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ */
+/*
+    Benchmark driver for the formatter.
+    It is linked with the static library objects by the "bench" make target.
+    A reproducible synthetic corpus is generated for C++, Java, and C#.
+    Each corpus is formatted with each predefined style, with the padding
+    options, and with indent-only to compare them with the default style.
+    It is formatted several times and the throughput is reported with its
+    variation between the runs.
+    Source files given on the command line are used instead of the generated
+    corpus, such as the worst case files in the bench/corpus directory.
+*/
+
+#include "astyle_bench.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+using namespace astyle;
+
+//-----------------------------------------------------------------------------
+// CorpusGenerator class
+// generates a reproducible source file for a language
+// the source is deliberately badly formatted so every style changes it
+//-----------------------------------------------------------------------------
+
+class CorpusGenerator
+{
+	public:
+		CorpusGenerator(int fileTypeArg) : fileType(fileTypeArg), seed(12345) {}
+		string generate(size_t corpusSize);
+
+	private:
+		int  random(int range);
+		string getIdentifier();
+		void addCommentBlock();
+		void addDeepNesting();
+		void addInitializerTable();
+		void addLongLines();
+		void addPreprocessor();
+		int  fileType;              // C_TYPE, JAVA_TYPE, or SHARP_TYPE
+		unsigned long seed;         // state of the random number generator
+		string out;                 // the generated source
+};
+
+// linear congruential generator, the same on all platforms
+int CorpusGenerator::random(int range)
+{
+	seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+	return static_cast<int>((seed >> 8) % static_cast<unsigned long>(range));
+}
+
+string CorpusGenerator::getIdentifier()
+{
+	static const char* words[] =
+	{
+		"count", "index", "value", "buffer", "length", "result", "node", "item",
+		"total", "offset", "limit", "state", "width", "height", "flags", "level"
+	};
+	const int wordCount = sizeof(words) / sizeof(words[0]);
+	char suffix[16];
+	sprintf(suffix, "%d", random(100));
+	return string(words[random(wordCount)]) + suffix;
+}
+
+// a documentation block and a function with a comment on every line
+void CorpusGenerator::addCommentBlock()
+{
+	out += "/*\n * Generated documentation block.\n";
+	for (int i = 0; i < 12; i++)
+		out += " * The " + getIdentifier() + " is compared with the " + getIdentifier() + ".\n";
+	out += " */\n";
+	string name = getIdentifier();
+	if (fileType == C_TYPE)
+		out += "int " + name + "_comments(int a,int b)\n{\n";
+	else
+		out += "public int " + name + "Comments(int a,int b)\n{\n";
+	for (int i = 0; i < 20; i++)
+	{
+		out += "int " + getIdentifier() + "=a+b*" + getIdentifier().substr(0, 1) + "0;";
+		out += "   // line comment " + getIdentifier() + "\n";
+		if (random(4) == 0)
+			out += "/* block comment */ a=b;\n";
+	}
+	out += "return a;\n}\n\n";
+}
+
+// nested statements with mixed bracket placement and no indentation
+void CorpusGenerator::addDeepNesting()
+{
+	const int depth = 24;
+	string name = getIdentifier();
+	if (fileType == C_TYPE)
+		out += "void " + name + "_nested(int x, int *p)\n{\n";
+	else
+		out += "public void " + name + "Nested(int x, int[] p)\n{\n";
+	vector<string> closers;
+	for (int i = 0; i < depth; i++)
+	{
+		string loopIndex = "i" + string(1, char('a' + i));
+		switch (random(4))
+		{
+			case 0:
+				out += "if(x>" + string(1, char('0' + i % 10)) + "){\n";
+				closers.push_back("}\n");
+				break;
+			case 1:
+				out += "for(int " + loopIndex + "=0;" + loopIndex + "<x;" + loopIndex + "++)\n{\n";
+				closers.push_back("}\n");
+				break;
+			case 2:
+				out += "while (x-- > 0)\n    {\n";
+				closers.push_back("}\n");
+				break;
+			default:
+				out += "switch(x){\ncase 1:\nx++;\nbreak;\ndefault:\n{\n";
+				closers.push_back("}\nbreak;\n}\n");
+				break;
+		}
+		out += "x=x+p[" + string(1, char('0' + i % 10)) + "];\n";
+	}
+	while (!closers.empty())
+	{
+		out += "x--;\n" + closers.back();
+		closers.pop_back();
+	}
+	out += "}\n\n";
+}
+
+// a large table of numbers and a table of structures
+void CorpusGenerator::addInitializerTable()
+{
+	const int entries = 400;
+	string name = getIdentifier();
+	if (fileType == C_TYPE)
+		out += "static const int " + name + "_table[] = {\n";
+	else if (fileType == JAVA_TYPE)
+		out += "static final int[] " + name + "Table = {\n";
+	else
+		out += "static readonly int[] " + name + "Table = {\n";
+	for (int i = 0; i < entries; i++)
+	{
+		char number[16];
+		sprintf(number, "%d,", random(100000));
+		out += number;
+		out += (i % 12 == 11) ? "\n" : " ";
+	}
+	out += "0 };\n";
+
+	if (fileType == C_TYPE)
+	{
+		out += "struct Entry { const char* name; int id; unsigned flags; };\n";
+		out += "static const Entry " + name + "_entries[] =\n{\n";
+		for (int i = 0; i < entries / 4; i++)
+		{
+			char entry[64];
+			sprintf(entry, "{\"%s\",%d,0x%04x},\n", getIdentifier().c_str(), i, random(65536));
+			out += entry;
+		}
+		out += "};\n\n";
+	}
+	else
+	{
+		out += "static string[] " + name + "Names = new string[] {\n";
+		for (int i = 0; i < entries / 4; i++)
+			out += "\"" + getIdentifier() + "\",\n";
+		out += "\"\" };\n\n";
+	}
+}
+
+// lines of several hundred characters
+void CorpusGenerator::addLongLines()
+{
+	string name = getIdentifier();
+	if (fileType == C_TYPE)
+		out += "int " + name + "_long(int a,int b,int c)\n{\n";
+	else
+		out += "public int " + name + "Long(int a,int b,int c)\n{\n";
+	for (int line = 0; line < 6; line++)
+	{
+		out += "int " + getIdentifier() + "=";
+		for (int i = 0; i < 40; i++)
+		{
+			out += (i % 3 == 0) ? "(a+b)*c" : "a*b-c/(b+1)";
+			out += (i < 39) ? "+" : ";\n";
+		}
+		out += "c=call" + getIdentifier() + "(";
+		for (int i = 0; i < 30; i++)
+			out += getIdentifier() + ((i < 29) ? "," : ");\n");
+	}
+	out += "return a;\n}\n\n";
+}
+
+// preprocessor conditionals, macros, and regions
+void CorpusGenerator::addPreprocessor()
+{
+	string name = getIdentifier();
+	if (fileType == C_TYPE)
+	{
+		out += "#ifdef " + name + "_H\n#define " + name + "_H\n";
+		for (int i = 0; i < 6; i++)
+		{
+			out += "#if defined(" + getIdentifier() + ") && (" + getIdentifier() + " > 2)\n";
+			out += "#  define MACRO_" + getIdentifier() + "(x, y) \\\n";
+			out += "    do { if ((x) > (y)) \\\n        x = y; \\\n    } while (0)\n";
+			out += "#elif " + getIdentifier() + "\n";
+			out += "#define " + getIdentifier() + " " + getIdentifier() + "\n";
+			out += "#else\n";
+			out += "int " + getIdentifier() + "(int a){\n#ifdef DEBUG\nreturn a+1;\n#else\nreturn a;\n#endif\n}\n";
+			out += "#endif\n";
+		}
+		out += "#endif\n\n";
+	}
+	else if (fileType == SHARP_TYPE)
+	{
+		out += "#region " + name + "\n";
+		for (int i = 0; i < 6; i++)
+		{
+			out += "#if DEBUG\n";
+			out += "public int " + getIdentifier() + "{get{return 1;}set{}}\n";
+			out += "#else\n";
+			out += "public int " + getIdentifier() + " { get; set; }\n";
+			out += "#endif\n";
+		}
+		out += "#endregion\n\n";
+	}
+	else
+	{
+		// Java has no preprocessor, use annotations instead
+		for (int i = 0; i < 6; i++)
+		{
+			out += "@SuppressWarnings(\"unchecked\")\n@Override\n";
+			out += "public int " + getIdentifier() + "(){return 1;}\n";
+		}
+		out += "\n";
+	}
+}
+
+// generate a source file of about corpusSize bytes
+string CorpusGenerator::generate(size_t corpusSize)
+{
+	out.clear();
+	out.reserve(corpusSize + 65536);
+	if (fileType == C_TYPE)
+		out += "#include <stdio.h>\nnamespace bench {\n";
+	else if (fileType == JAVA_TYPE)
+		out += "package bench;\nimport java.util.*;\npublic class Bench {\n";
+	else
+		out += "using System;\nnamespace Bench {\npublic class Bench {\n";
+	if (fileType == C_TYPE)
+		out += "class Bench {\npublic:\n";
+
+	while (out.length() < corpusSize)
+	{
+		addCommentBlock();
+		addDeepNesting();
+		addPreprocessor();
+		addLongLines();
+		addInitializerTable();
+	}
+
+	if (fileType == C_TYPE)
+		out += "};\n}\n";
+	else if (fileType == JAVA_TYPE)
+		out += "}\n";
+	else
+		out += "}\n}\n";
+	return out;
+}
+
+//-----------------------------------------------------------------------------
+// benchmark functions
+//-----------------------------------------------------------------------------
+
+// the options used with a style
+enum BenchOptions { STYLE_OPTIONS, PADDED_OPTIONS, INDENT_ONLY_OPTIONS };
+
+// format a corpus and return the number of output lines
+// the output length is added to outputLength so the output is used
+int formatCorpus(const string &corpus, int fileType, FormatStyle style, BenchOptions options,
+                 size_t &outputLength)
+{
+	ASFormatter formatter;
+	if (fileType == JAVA_TYPE)
+		formatter.setJavaStyle();
+	else if (fileType == SHARP_TYPE)
+		formatter.setSharpStyle();
+	else
+		formatter.setCStyle();
+	formatter.setFormattingStyle(style);
+	if (options == PADDED_OPTIONS)
+	{
+		// most of the padding and breaking options are on
+		formatter.setOperatorPaddingMode(true);
+		formatter.setParensOutsidePaddingMode(true);
+		formatter.setParensInsidePaddingMode(true);
+		formatter.setParensHeaderPaddingMode(true);
+		formatter.setPointerAlignment(PTR_ALIGN_TYPE);
+		formatter.setBreakBlocksMode(true);
+		formatter.setAddBracketsMode(true);
+		formatter.setMaxCodeLength(80);
+	}
+	formatter.setIndentOnlyMode(options == INDENT_ONLY_OPTIONS);
+
+	BenchIterator iterator(corpus);
+	formatter.init(&iterator);
+	int lines = 0;
+	while (formatter.hasMoreLines())
+	{
+		outputLength += formatter.nextLine().length() + 1;
+		lines++;
+	}
+	return lines;
+}
+
+// read a source file with the line ends converted to LF
+// the language is determined by the file extension
+bool readCorpusFile(const string &fileName, string &corpus, int &fileType)
+{
+	ifstream in(fileName.c_str(), ios::binary);
+	if (!in)
+		return false;
+	stringstream text;
+	text << in.rdbuf();
+	corpus.clear();
+	const string &raw = text.str();
+	for (size_t i = 0; i < raw.length(); i++)
+	{
+		if (raw[i] == '\r')
+		{
+			if (i + 1 < raw.length() && raw[i + 1] == '\n')
+				continue;
+			corpus += '\n';
+		}
+		else
+			corpus += raw[i];
+	}
+	size_t dot = fileName.rfind('.');
+	string extension = dot == string::npos ? string() : fileName.substr(dot + 1);
+	if (extension == "java")
+		fileType = JAVA_TYPE;
+	else if (extension == "cs")
+		fileType = SHARP_TYPE;
+	else
+		fileType = C_TYPE;
+	return true;
+}
+
+void printUsage()
+{
+	printf("Usage: astylebench [-r repetitions] [-s corpus-kilobytes] [file...]\n");
+	printf("Formats a synthetic C++, Java, and C# corpus with each predefined style,\n");
+	printf("with the padding options, and with indent-only.\n");
+	printf("The source files are formatted instead of the corpus if they are given.\n");
+}
+
+int main(int argc, char** argv)
+{
+	int repetitions = 5;
+	int corpusKilobytes = 256;
+	vector<string> fileNames;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			repetitions = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			corpusKilobytes = atoi(argv[++i]);
+		else if (argv[i][0] != '-')
+			fileNames.push_back(argv[i]);
+		else
+		{
+			printUsage();
+			return EXIT_FAILURE;
+		}
+	}
+	if (repetitions < 1 || corpusKilobytes < 1)
+	{
+		printUsage();
+		return EXIT_FAILURE;
+	}
+
+	static const char* styleNames[] =
+	{
+		"none", "allman", "java", "kr", "stroustrup", "whitesmith", "vtk", "banner",
+		"gnu", "linux", "horstmann", "1tbs", "google", "pico", "lisp",
+		"padded", "indent-only"
+	};
+	// the last entries are the padding options and indent-only with the default style
+	const int styleCount = sizeof(styleNames) / sizeof(styleNames[0]);
+	const int paddedStyle = styleCount - 2;
+	const int indentOnlyStyle = styleCount - 1;
+
+	// the generated corpus for each language, or the files
+	vector<string> corpusNames;
+	vector<int> fileTypes;
+	vector<string> corpora;
+	if (fileNames.empty())
+	{
+		static const int languageTypes[] = { C_TYPE, JAVA_TYPE, SHARP_TYPE };
+		static const char* languageNames[] = { "C++", "Java", "C#" };
+		for (int language = 0; language < 3; language++)
+		{
+			CorpusGenerator generator(languageTypes[language]);
+			corpusNames.push_back(languageNames[language]);
+			fileTypes.push_back(languageTypes[language]);
+			corpora.push_back(generator.generate(corpusKilobytes * 1024));
+		}
+		printf("Artistic Style formatter benchmark\n");
+		printf("%d repetitions of a %d KB corpus for each language and style\n\n",
+		       repetitions, corpusKilobytes);
+	}
+	else
+	{
+		for (size_t i = 0; i < fileNames.size(); i++)
+		{
+			string corpus;
+			int fileType;
+			if (!readCorpusFile(fileNames[i], corpus, fileType))
+			{
+				printf("Cannot open file %s\n", fileNames[i].c_str());
+				return EXIT_FAILURE;
+			}
+			size_t separator = fileNames[i].find_last_of("/\\");
+			corpusNames.push_back(separator == string::npos
+			                      ? fileNames[i] : fileNames[i].substr(separator + 1));
+			fileTypes.push_back(fileType);
+			corpora.push_back(corpus);
+		}
+		printf("Artistic Style formatter benchmark\n");
+		printf("%d repetitions of each file and style\n\n", repetitions);
+	}
+	printf("%-20s %-12s %10s %12s %10s\n", "", "style", "MB/sec", "lines/sec", "variation");
+
+	size_t outputLength = 0;
+	double allMegabytes = 0;
+	double allSeconds = 0;
+	for (size_t language = 0; language < corpora.size(); language++)
+	{
+		const string &corpus = corpora[language];
+		double megabytes = corpus.length() / (1024.0 * 1024.0);
+		for (int style = 0; style < styleCount; style++)
+		{
+			vector<double> rates;
+			double lineRate = 0;
+			for (int rep = 0; rep < repetitions; rep++)
+			{
+				double startTime = ASProfiler::getTime();
+				BenchOptions options = STYLE_OPTIONS;
+				if (style == paddedStyle)
+					options = PADDED_OPTIONS;
+				else if (style == indentOnlyStyle)
+					options = INDENT_ONLY_OPTIONS;
+				int lines = formatCorpus(corpus, fileTypes[language],
+				                         options == STYLE_OPTIONS ? static_cast<FormatStyle>(style) : STYLE_NONE,
+				                         options, outputLength);
+				double seconds = ASProfiler::getTime() - startTime;
+				if (seconds <= 0)
+					seconds = 1e-9;
+				rates.push_back(megabytes / seconds);
+				lineRate += lines / seconds;
+				allMegabytes += megabytes;
+				allSeconds += seconds;
+			}
+			// mean and relative standard deviation of the runs
+			double mean = 0;
+			for (size_t i = 0; i < rates.size(); i++)
+				mean += rates[i];
+			mean /= rates.size();
+			double variance = 0;
+			for (size_t i = 0; i < rates.size(); i++)
+				variance += (rates[i] - mean) * (rates[i] - mean);
+			if (rates.size() > 1)
+				variance /= rates.size() - 1;
+			double variation = mean > 0 ? sqrt(variance) * 100 / mean : 0;
+			printf("%-20s %-12s %10.2f %12.0f %9.1f%%\n", corpusNames[language].c_str(),
+			       styleNames[style], mean, lineRate / repetitions, variation);
+		}
+	}
+	printf("\n%.2f MB formatted in %.2f seconds, %.2f MB/sec overall (%lu bytes output)\n",
+	       allMegabytes, allSeconds, allMegabytes / allSeconds, (unsigned long) outputLength);
+	return EXIT_SUCCESS;
+}
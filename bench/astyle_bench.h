@@ -0,0 +1,84 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   astyle_bench.h
+ *
+ *   Copyright (C) 2014 by Jim Pattee
+ *   <http://www.gnu.org/licenses/lgpl-3.0.html>
+ *
+ *   This file is a part of Artistic Style - an indentation and
+ *   reformatting tool for C, C++, C# and Java source files.
+ *   <http://astyle.sourceforge.net>
+ *
+ *   Artistic Style is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU Lesser General Public License as published
+ *   by the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Artistic Style is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public License
+ *   along with Artistic Style.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ */
+
+#ifndef ASTYLE_BENCH_H
+#define ASTYLE_BENCH_H
+
+#include "astyle.h"
+
+namespace astyle {
+
+//-----------------------------------------------------------------------------
+// BenchIterator class
+// source iterator for a benchmark corpus held in memory
+// the corpus must have only LF line ends
+//-----------------------------------------------------------------------------
+
+class BenchIterator : public ASSourceIterator
+{
+	public:
+		BenchIterator(const string &textArg) : text(textArg), position(0), peekPosition(0) {}
+		virtual ~BenchIterator() {}
+		virtual int getStreamLength() const { return static_cast<int>(text.length()); }
+		virtual bool hasMoreLines() const { return position < text.length(); }
+		virtual string nextLine(bool /*emptyLineWasDeleted*/ = false) {
+			peekPosition = 0;
+			return getLine(position);
+		}
+		virtual string peekNextLine() {
+			if (peekPosition == 0)
+				peekPosition = position;
+			if (peekPosition >= text.length())
+				return string();
+			return getLine(peekPosition);
+		}
+		virtual void peekReset() { peekPosition = 0; }
+		virtual streamoff tellg() { return static_cast<streamoff>(position); }
+		// restart at the beginning of the corpus
+		void reset() { position = 0; peekPosition = 0; }
+
+	private:
+		BenchIterator(const BenchIterator &copy);       // not to be implemented
+		BenchIterator &operator=(BenchIterator &);      // not to be implemented
+
+		// get the line at a position and move the position to the next line
+		string getLine(size_t &linePosition) const {
+			size_t lineEnd = text.find('\n', linePosition);
+			if (lineEnd == string::npos)
+				lineEnd = text.length();
+			string line = text.substr(linePosition, lineEnd - linePosition);
+			linePosition = (lineEnd < text.length()) ? lineEnd + 1 : lineEnd;
+			return line;
+		}
+
+		const string &text;         // corpus being formatted
+		size_t position;            // start of the next line
+		size_t peekPosition;        // start of the next line to peek, 0 if not peeking
+};
+
+}   // end of astyle namespace
+
+#endif // closes ASTYLE_BENCH_H
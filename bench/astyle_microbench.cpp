@@ -0,0 +1,337 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   astyle_microbench.cpp
+ *
+ *   Copyright (C) 2014 by Jim Pattee
+ *   <http://www.gnu.org/licenses/lgpl-3.0.html>
+ *
+ *   This file is a part of Artistic Style - an indentation and
+ *   reformatting tool for C, C++, C# and Java source files.
+ *   <http://astyle.sourceforge.net>
+ *
+ *   Artistic Style is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU Lesser General Public License as published
+ *   by the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   Artistic Style is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public License
+ *   along with Artistic Style.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ */
+/*
+    Micro-benchmarks for the functions called for each character.
+    It is linked with the static library objects by the "microbench" make target.
+    Each function is called with a fixed set of inputs. The iteration count
+    is calibrated to the requested time and the best of several runs is
+    reported in nanoseconds per call.
+*/
+
+#include "astyle_bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace astyle {
+
+// the source following the current line for the functions that peek ahead
+static const char* peekSource =
+    "\n"
+    "/* a comment that continues\n"
+    "   on the next line */\n"
+    "\n"
+    "// a line comment\n"
+    "    value = other;\n"
+    "}\n";
+
+//-----------------------------------------------------------------------------
+// ASMicroBench class
+// is a friend of the classes containing the private functions
+//-----------------------------------------------------------------------------
+
+class ASMicroBench
+{
+	public:
+		ASMicroBench(int targetMillisecondsArg);
+		~ASMicroBench() {}
+		void run(int nameCount, char** names);
+
+	private:
+		ASMicroBench(const ASMicroBench &copy);       // not to be implemented
+		ASMicroBench &operator=(ASMicroBench &);      // not to be implemented
+
+		typedef void (ASMicroBench::*BenchFunction)(int iterations);
+		double getSecondsPerCall(BenchFunction function);
+		void benchCheckIfTemplateOpener(int iterations);
+		void benchFindHeader(int iterations);
+		void benchFindOperator(int iterations);
+		void benchGetKeywordId(int iterations);
+		void benchIsLegalNameChar(int iterations);
+		void benchIsPointerOrReference(int iterations);
+		void benchParseCurrentLine(int iterations);
+		void benchPeekNextChar(int iterations);
+		void benchPeekNextText(int iterations);
+		void benchPreLineWS(int iterations);
+		void setCurrentLine(const char* line, char ch);
+
+		int targetMilliseconds;             // calibrated time of each run
+		string source;                      // text for the source iterator
+		BenchIterator iterator;
+		ASFormatter formatter;
+		ASEnhancer enhancer;
+		vector<const pair<const string, const string>* > indentableMacros;
+		volatile size_t sink;               // results are stored so the calls are not removed
+};
+
+ASMicroBench::ASMicroBench(int targetMillisecondsArg)
+	: targetMilliseconds(targetMillisecondsArg),
+	  source(peekSource),
+	  iterator(source),
+	  sink(0)
+{
+	formatter.setCStyle();
+	formatter.init(&iterator);
+	enhancer.init(C_TYPE, 4, 4, false, false, false, false, false, false, false, &indentableMacros);
+}
+
+// position the formatter at the first occurrence of a character in a line
+void ASMicroBench::setCurrentLine(const char* line, char ch)
+{
+	formatter.currentLine = line;
+	formatter.nextTextIndex.clear();
+	formatter.charNum = formatter.currentLine.find(ch);
+	formatter.currentChar = ch;
+	assert(formatter.charNum >= 0);
+}
+
+void ASMicroBench::benchCheckIfTemplateOpener(int iterations)
+{
+	static const char* lines[] =
+	{
+		"vector<pair<int, string> > items;",
+		"if (count < limit && value > 0)",
+		"map<string, vector<const string*> >::iterator it = m.begin();",
+		"x = a < b;"
+	};
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	for (int i = 0; i < iterations; i++)
+	{
+		setCurrentLine(lines[i % lineCount], '<');
+		formatter.isInTemplate = false;
+		formatter.checkIfTemplateOpener();
+		sink += formatter.templateDepth;
+	}
+	formatter.isInTemplate = false;
+	formatter.templateDepth = 0;
+}
+
+void ASMicroBench::benchFindHeader(int iterations)
+{
+	static const char* lines[] = { "} else if (count > 0) {", "while (x)", "elsewhere = 1;", "return value;" };
+	static const int positions[] = { 2, 0, 0, 0 };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+	{
+		int index = i % lineCount;
+		sink += (size_t) formatter.ASBeautifier::findHeader(text[index], positions[index], formatter.headers);
+	}
+}
+
+// uses the same lines as benchFindHeader
+void ASMicroBench::benchGetKeywordId(int iterations)
+{
+	static const char* lines[] = { "} else if (count > 0) {", "while (x)", "elsewhere = 1;", "return value;" };
+	static const int positions[] = { 2, 0, 0, 0 };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+	{
+		int index = i % lineCount;
+		sink += (size_t) formatter.getKeywordId(text[index], positions[index], formatter.keywords);
+	}
+}
+
+void ASMicroBench::benchFindOperator(int iterations)
+{
+	static const char* lines[] = { "a <<= b;", "x->y", "a == b", "p++;", "a ? b : c" };
+	static const int positions[] = { 2, 1, 2, 1, 2 };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+	{
+		int index = i % lineCount;
+		sink += (size_t) formatter.ASBeautifier::findOperator(text[index], positions[index], formatter.operators);
+	}
+}
+
+void ASMicroBench::benchIsLegalNameChar(int iterations)
+{
+	static const char chars[] = "a_Z9.$@ (\t\x80";
+	const int charCount = sizeof(chars) - 1;
+	for (int i = 0; i < iterations; i++)
+		sink += formatter.isLegalNameChar(chars[i % charCount]);
+}
+
+void ASMicroBench::benchIsPointerOrReference(int iterations)
+{
+	static const char* lines[] = { "int* p = q;", "x = a & b;", "x = *p;", "void f(const string &line)" };
+	static const char chars[] = { '*', '&', '*', '&' };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	for (int i = 0; i < iterations; i++)
+	{
+		int index = i % lineCount;
+		setCurrentLine(lines[index], chars[index]);
+		sink += formatter.isPointerOrReference();
+	}
+}
+
+void ASMicroBench::benchParseCurrentLine(int iterations)
+{
+	static const char* lines[] =
+	{
+		"    x = \"quoted // text\";    // comment",
+		"    /* block */ a = b;",
+		"    if (a) { b = c; }",
+		"    call(a, 'x', \"\\\"\");"
+	};
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+	{
+		string line = text[i % lineCount];
+		enhancer.parseCurrentLine(line, line.find_first_not_of(" \t"), false, false);
+		sink += line.length();
+	}
+}
+
+void ASMicroBench::benchPeekNextChar(int iterations)
+{
+	static const char* lines[] = { "x    = y", "if (a)", "value;", "a\t\t\t\t\t\t\t\t\t\t(b)" };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+		sink += formatter.ASBase::peekNextChar(text[i % lineCount], 0);
+}
+
+void ASMicroBench::benchPeekNextText(int iterations)
+{
+	// the empty line continues with the following source lines
+	static const char* lines[] = { "  value;", "", "   /* comment */ next", "// comment" };
+	const int lineCount = sizeof(lines) / sizeof(lines[0]);
+	vector<string> text(lines, lines + lineCount);
+	for (int i = 0; i < iterations; i++)
+		sink += formatter.peekNextText(text[i % lineCount]).length();
+}
+
+void ASMicroBench::benchPreLineWS(int iterations)
+{
+	static const int indents[] = { 0, 1, 3, 6 };
+	static const int spaceIndents[] = { 0, 2, 0, 5 };
+	const int lineCount = sizeof(indents) / sizeof(indents[0]);
+	for (int i = 0; i < iterations; i++)
+	{
+		int index = i % lineCount;
+		sink += formatter.preLineWS(indents[index], spaceIndents[index]).length();
+	}
+}
+
+// calibrate the iterations to the target time and return the best time of several runs
+double ASMicroBench::getSecondsPerCall(BenchFunction function)
+{
+	const int runs = 5;
+	double targetSeconds = targetMilliseconds / 1000.0;
+	int iterations = 1000;
+	double seconds = 0;
+	for (;;)
+	{
+		double startTime = ASProfiler::getTime();
+		(this->*function)(iterations);
+		seconds = ASProfiler::getTime() - startTime;
+		if (seconds >= targetSeconds / 10 || iterations > 100000000)
+			break;
+		iterations *= 10;
+	}
+	if (seconds > 0 && seconds < targetSeconds)
+		iterations = static_cast<int>(iterations * (targetSeconds / seconds));
+
+	double bestSeconds = 0;
+	for (int run = 0; run < runs; run++)
+	{
+		double startTime = ASProfiler::getTime();
+		(this->*function)(iterations);
+		seconds = (ASProfiler::getTime() - startTime) / iterations;
+		if (run == 0 || seconds < bestSeconds)
+			bestSeconds = seconds;
+	}
+	return bestSeconds;
+}
+
+// run the benchmarks with a name containing one of the names
+// all are run if there are no names
+void ASMicroBench::run(int nameCount, char** names)
+{
+	struct Benchmark
+	{
+		const char* name;
+		BenchFunction function;
+	};
+	static const Benchmark benchmarks[] =
+	{
+		{ "findHeader",            &ASMicroBench::benchFindHeader },
+		{ "getKeywordId",          &ASMicroBench::benchGetKeywordId },
+		{ "findOperator",          &ASMicroBench::benchFindOperator },
+		{ "peekNextChar",          &ASMicroBench::benchPeekNextChar },
+		{ "peekNextText",          &ASMicroBench::benchPeekNextText },
+		{ "isLegalNameChar",       &ASMicroBench::benchIsLegalNameChar },
+		{ "isPointerOrReference",  &ASMicroBench::benchIsPointerOrReference },
+		{ "checkIfTemplateOpener", &ASMicroBench::benchCheckIfTemplateOpener },
+		{ "parseCurrentLine",      &ASMicroBench::benchParseCurrentLine },
+		{ "preLineWS",             &ASMicroBench::benchPreLineWS },
+	};
+	const int benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+	printf("%-24s %10s\n", "function", "ns/call");
+	for (int i = 0; i < benchmarkCount; i++)
+	{
+		bool isSelected = (nameCount == 0);
+		for (int j = 0; j < nameCount && !isSelected; j++)
+			isSelected = (strstr(benchmarks[i].name, names[j]) != NULL);
+		if (!isSelected)
+			continue;
+		double seconds = getSecondsPerCall(benchmarks[i].function);
+		printf("%-24s %10.1f\n", benchmarks[i].name, seconds * 1e9);
+	}
+}
+
+}   // end of astyle namespace
+
+//-----------------------------------------------------------------------------
+// main function
+//-----------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+	int targetMilliseconds = 200;
+	int firstName = 1;
+	if (argc > 2 && strcmp(argv[1], "-t") == 0)
+	{
+		targetMilliseconds = atoi(argv[2]);
+		firstName = 3;
+	}
+	if (targetMilliseconds < 1 || (argc > firstName && argv[firstName][0] == '-'))
+	{
+		printf("Usage: astylemicrobench [-t milliseconds] [function...]\n");
+		printf("Times the functions called for each character in nanoseconds per call.\n");
+		return EXIT_FAILURE;
+	}
+
+	astyle::ASMicroBench microBench(targetMilliseconds);
+	microBench.run(argc - firstName, argv + firstName);
+	return EXIT_SUCCESS;
+}
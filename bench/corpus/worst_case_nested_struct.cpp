@@ -0,0 +1,884 @@
+// Worst case for the look ahead of isStructAccessModified().
+// Each struct is searched for access modifiers to its closing bracket.
+// Without the saved results the nested structs are searched again at each level.
+
+struct Level0 {
+    int member0; // member 0 of level 0
+    int member1; // member 1 of level 0
+    int member2; // member 2 of level 0
+    int member3; // member 3 of level 0
+    int member4; // member 4 of level 0
+    int member5; // member 5 of level 0
+    int member6; // member 6 of level 0
+    int member7; // member 7 of level 0
+    int member8; // member 8 of level 0
+    int member9; // member 9 of level 0
+    int member10; // member 10 of level 0
+    int member11; // member 11 of level 0
+    int member12; // member 12 of level 0
+    int member13; // member 13 of level 0
+    int member14; // member 14 of level 0
+    int member15; // member 15 of level 0
+    int member16; // member 16 of level 0
+    int member17; // member 17 of level 0
+    int member18; // member 18 of level 0
+    int member19; // member 19 of level 0
+    struct Level1 {
+        int member0; // member 0 of level 1
+        int member1; // member 1 of level 1
+        int member2; // member 2 of level 1
+        int member3; // member 3 of level 1
+        int member4; // member 4 of level 1
+        int member5; // member 5 of level 1
+        int member6; // member 6 of level 1
+        int member7; // member 7 of level 1
+        int member8; // member 8 of level 1
+        int member9; // member 9 of level 1
+        int member10; // member 10 of level 1
+        int member11; // member 11 of level 1
+        int member12; // member 12 of level 1
+        int member13; // member 13 of level 1
+        int member14; // member 14 of level 1
+        int member15; // member 15 of level 1
+        int member16; // member 16 of level 1
+        int member17; // member 17 of level 1
+        int member18; // member 18 of level 1
+        int member19; // member 19 of level 1
+        struct Level2 {
+            int member0; // member 0 of level 2
+            int member1; // member 1 of level 2
+            int member2; // member 2 of level 2
+            int member3; // member 3 of level 2
+            int member4; // member 4 of level 2
+            int member5; // member 5 of level 2
+            int member6; // member 6 of level 2
+            int member7; // member 7 of level 2
+            int member8; // member 8 of level 2
+            int member9; // member 9 of level 2
+            int member10; // member 10 of level 2
+            int member11; // member 11 of level 2
+            int member12; // member 12 of level 2
+            int member13; // member 13 of level 2
+            int member14; // member 14 of level 2
+            int member15; // member 15 of level 2
+            int member16; // member 16 of level 2
+            int member17; // member 17 of level 2
+            int member18; // member 18 of level 2
+            int member19; // member 19 of level 2
+            struct Level3 {
+                int member0; // member 0 of level 3
+                int member1; // member 1 of level 3
+                int member2; // member 2 of level 3
+                int member3; // member 3 of level 3
+                int member4; // member 4 of level 3
+                int member5; // member 5 of level 3
+                int member6; // member 6 of level 3
+                int member7; // member 7 of level 3
+                int member8; // member 8 of level 3
+                int member9; // member 9 of level 3
+                int member10; // member 10 of level 3
+                int member11; // member 11 of level 3
+                int member12; // member 12 of level 3
+                int member13; // member 13 of level 3
+                int member14; // member 14 of level 3
+                int member15; // member 15 of level 3
+                int member16; // member 16 of level 3
+                int member17; // member 17 of level 3
+                int member18; // member 18 of level 3
+                int member19; // member 19 of level 3
+                struct Level4 {
+                    int member0; // member 0 of level 4
+                    int member1; // member 1 of level 4
+                    int member2; // member 2 of level 4
+                    int member3; // member 3 of level 4
+                    int member4; // member 4 of level 4
+                    int member5; // member 5 of level 4
+                    int member6; // member 6 of level 4
+                    int member7; // member 7 of level 4
+                    int member8; // member 8 of level 4
+                    int member9; // member 9 of level 4
+                    int member10; // member 10 of level 4
+                    int member11; // member 11 of level 4
+                    int member12; // member 12 of level 4
+                    int member13; // member 13 of level 4
+                    int member14; // member 14 of level 4
+                    int member15; // member 15 of level 4
+                    int member16; // member 16 of level 4
+                    int member17; // member 17 of level 4
+                    int member18; // member 18 of level 4
+                    int member19; // member 19 of level 4
+                    struct Level5 {
+                        int member0; // member 0 of level 5
+                        int member1; // member 1 of level 5
+                        int member2; // member 2 of level 5
+                        int member3; // member 3 of level 5
+                        int member4; // member 4 of level 5
+                        int member5; // member 5 of level 5
+                        int member6; // member 6 of level 5
+                        int member7; // member 7 of level 5
+                        int member8; // member 8 of level 5
+                        int member9; // member 9 of level 5
+                        int member10; // member 10 of level 5
+                        int member11; // member 11 of level 5
+                        int member12; // member 12 of level 5
+                        int member13; // member 13 of level 5
+                        int member14; // member 14 of level 5
+                        int member15; // member 15 of level 5
+                        int member16; // member 16 of level 5
+                        int member17; // member 17 of level 5
+                        int member18; // member 18 of level 5
+                        int member19; // member 19 of level 5
+                        struct Level6 {
+                            int member0; // member 0 of level 6
+                            int member1; // member 1 of level 6
+                            int member2; // member 2 of level 6
+                            int member3; // member 3 of level 6
+                            int member4; // member 4 of level 6
+                            int member5; // member 5 of level 6
+                            int member6; // member 6 of level 6
+                            int member7; // member 7 of level 6
+                            int member8; // member 8 of level 6
+                            int member9; // member 9 of level 6
+                            int member10; // member 10 of level 6
+                            int member11; // member 11 of level 6
+                            int member12; // member 12 of level 6
+                            int member13; // member 13 of level 6
+                            int member14; // member 14 of level 6
+                            int member15; // member 15 of level 6
+                            int member16; // member 16 of level 6
+                            int member17; // member 17 of level 6
+                            int member18; // member 18 of level 6
+                            int member19; // member 19 of level 6
+                            struct Level7 {
+                                int member0; // member 0 of level 7
+                                int member1; // member 1 of level 7
+                                int member2; // member 2 of level 7
+                                int member3; // member 3 of level 7
+                                int member4; // member 4 of level 7
+                                int member5; // member 5 of level 7
+                                int member6; // member 6 of level 7
+                                int member7; // member 7 of level 7
+                                int member8; // member 8 of level 7
+                                int member9; // member 9 of level 7
+                                int member10; // member 10 of level 7
+                                int member11; // member 11 of level 7
+                                int member12; // member 12 of level 7
+                                int member13; // member 13 of level 7
+                                int member14; // member 14 of level 7
+                                int member15; // member 15 of level 7
+                                int member16; // member 16 of level 7
+                                int member17; // member 17 of level 7
+                                int member18; // member 18 of level 7
+                                int member19; // member 19 of level 7
+                                struct Level8 {
+                                    int member0; // member 0 of level 8
+                                    int member1; // member 1 of level 8
+                                    int member2; // member 2 of level 8
+                                    int member3; // member 3 of level 8
+                                    int member4; // member 4 of level 8
+                                    int member5; // member 5 of level 8
+                                    int member6; // member 6 of level 8
+                                    int member7; // member 7 of level 8
+                                    int member8; // member 8 of level 8
+                                    int member9; // member 9 of level 8
+                                    int member10; // member 10 of level 8
+                                    int member11; // member 11 of level 8
+                                    int member12; // member 12 of level 8
+                                    int member13; // member 13 of level 8
+                                    int member14; // member 14 of level 8
+                                    int member15; // member 15 of level 8
+                                    int member16; // member 16 of level 8
+                                    int member17; // member 17 of level 8
+                                    int member18; // member 18 of level 8
+                                    int member19; // member 19 of level 8
+                                    struct Level9 {
+                                        int member0; // member 0 of level 9
+                                        int member1; // member 1 of level 9
+                                        int member2; // member 2 of level 9
+                                        int member3; // member 3 of level 9
+                                        int member4; // member 4 of level 9
+                                        int member5; // member 5 of level 9
+                                        int member6; // member 6 of level 9
+                                        int member7; // member 7 of level 9
+                                        int member8; // member 8 of level 9
+                                        int member9; // member 9 of level 9
+                                        int member10; // member 10 of level 9
+                                        int member11; // member 11 of level 9
+                                        int member12; // member 12 of level 9
+                                        int member13; // member 13 of level 9
+                                        int member14; // member 14 of level 9
+                                        int member15; // member 15 of level 9
+                                        int member16; // member 16 of level 9
+                                        int member17; // member 17 of level 9
+                                        int member18; // member 18 of level 9
+                                        int member19; // member 19 of level 9
+                                        struct Level10 {
+                                            int member0; // member 0 of level 10
+                                            int member1; // member 1 of level 10
+                                            int member2; // member 2 of level 10
+                                            int member3; // member 3 of level 10
+                                            int member4; // member 4 of level 10
+                                            int member5; // member 5 of level 10
+                                            int member6; // member 6 of level 10
+                                            int member7; // member 7 of level 10
+                                            int member8; // member 8 of level 10
+                                            int member9; // member 9 of level 10
+                                            int member10; // member 10 of level 10
+                                            int member11; // member 11 of level 10
+                                            int member12; // member 12 of level 10
+                                            int member13; // member 13 of level 10
+                                            int member14; // member 14 of level 10
+                                            int member15; // member 15 of level 10
+                                            int member16; // member 16 of level 10
+                                            int member17; // member 17 of level 10
+                                            int member18; // member 18 of level 10
+                                            int member19; // member 19 of level 10
+                                            struct Level11 {
+                                                int member0; // member 0 of level 11
+                                                int member1; // member 1 of level 11
+                                                int member2; // member 2 of level 11
+                                                int member3; // member 3 of level 11
+                                                int member4; // member 4 of level 11
+                                                int member5; // member 5 of level 11
+                                                int member6; // member 6 of level 11
+                                                int member7; // member 7 of level 11
+                                                int member8; // member 8 of level 11
+                                                int member9; // member 9 of level 11
+                                                int member10; // member 10 of level 11
+                                                int member11; // member 11 of level 11
+                                                int member12; // member 12 of level 11
+                                                int member13; // member 13 of level 11
+                                                int member14; // member 14 of level 11
+                                                int member15; // member 15 of level 11
+                                                int member16; // member 16 of level 11
+                                                int member17; // member 17 of level 11
+                                                int member18; // member 18 of level 11
+                                                int member19; // member 19 of level 11
+                                                struct Level12 {
+                                                    int member0; // member 0 of level 12
+                                                    int member1; // member 1 of level 12
+                                                    int member2; // member 2 of level 12
+                                                    int member3; // member 3 of level 12
+                                                    int member4; // member 4 of level 12
+                                                    int member5; // member 5 of level 12
+                                                    int member6; // member 6 of level 12
+                                                    int member7; // member 7 of level 12
+                                                    int member8; // member 8 of level 12
+                                                    int member9; // member 9 of level 12
+                                                    int member10; // member 10 of level 12
+                                                    int member11; // member 11 of level 12
+                                                    int member12; // member 12 of level 12
+                                                    int member13; // member 13 of level 12
+                                                    int member14; // member 14 of level 12
+                                                    int member15; // member 15 of level 12
+                                                    int member16; // member 16 of level 12
+                                                    int member17; // member 17 of level 12
+                                                    int member18; // member 18 of level 12
+                                                    int member19; // member 19 of level 12
+                                                    struct Level13 {
+                                                        int member0; // member 0 of level 13
+                                                        int member1; // member 1 of level 13
+                                                        int member2; // member 2 of level 13
+                                                        int member3; // member 3 of level 13
+                                                        int member4; // member 4 of level 13
+                                                        int member5; // member 5 of level 13
+                                                        int member6; // member 6 of level 13
+                                                        int member7; // member 7 of level 13
+                                                        int member8; // member 8 of level 13
+                                                        int member9; // member 9 of level 13
+                                                        int member10; // member 10 of level 13
+                                                        int member11; // member 11 of level 13
+                                                        int member12; // member 12 of level 13
+                                                        int member13; // member 13 of level 13
+                                                        int member14; // member 14 of level 13
+                                                        int member15; // member 15 of level 13
+                                                        int member16; // member 16 of level 13
+                                                        int member17; // member 17 of level 13
+                                                        int member18; // member 18 of level 13
+                                                        int member19; // member 19 of level 13
+                                                        struct Level14 {
+                                                            int member0; // member 0 of level 14
+                                                            int member1; // member 1 of level 14
+                                                            int member2; // member 2 of level 14
+                                                            int member3; // member 3 of level 14
+                                                            int member4; // member 4 of level 14
+                                                            int member5; // member 5 of level 14
+                                                            int member6; // member 6 of level 14
+                                                            int member7; // member 7 of level 14
+                                                            int member8; // member 8 of level 14
+                                                            int member9; // member 9 of level 14
+                                                            int member10; // member 10 of level 14
+                                                            int member11; // member 11 of level 14
+                                                            int member12; // member 12 of level 14
+                                                            int member13; // member 13 of level 14
+                                                            int member14; // member 14 of level 14
+                                                            int member15; // member 15 of level 14
+                                                            int member16; // member 16 of level 14
+                                                            int member17; // member 17 of level 14
+                                                            int member18; // member 18 of level 14
+                                                            int member19; // member 19 of level 14
+                                                            struct Level15 {
+                                                                int member0; // member 0 of level 15
+                                                                int member1; // member 1 of level 15
+                                                                int member2; // member 2 of level 15
+                                                                int member3; // member 3 of level 15
+                                                                int member4; // member 4 of level 15
+                                                                int member5; // member 5 of level 15
+                                                                int member6; // member 6 of level 15
+                                                                int member7; // member 7 of level 15
+                                                                int member8; // member 8 of level 15
+                                                                int member9; // member 9 of level 15
+                                                                int member10; // member 10 of level 15
+                                                                int member11; // member 11 of level 15
+                                                                int member12; // member 12 of level 15
+                                                                int member13; // member 13 of level 15
+                                                                int member14; // member 14 of level 15
+                                                                int member15; // member 15 of level 15
+                                                                int member16; // member 16 of level 15
+                                                                int member17; // member 17 of level 15
+                                                                int member18; // member 18 of level 15
+                                                                int member19; // member 19 of level 15
+                                                                struct Level16 {
+                                                                    int member0; // member 0 of level 16
+                                                                    int member1; // member 1 of level 16
+                                                                    int member2; // member 2 of level 16
+                                                                    int member3; // member 3 of level 16
+                                                                    int member4; // member 4 of level 16
+                                                                    int member5; // member 5 of level 16
+                                                                    int member6; // member 6 of level 16
+                                                                    int member7; // member 7 of level 16
+                                                                    int member8; // member 8 of level 16
+                                                                    int member9; // member 9 of level 16
+                                                                    int member10; // member 10 of level 16
+                                                                    int member11; // member 11 of level 16
+                                                                    int member12; // member 12 of level 16
+                                                                    int member13; // member 13 of level 16
+                                                                    int member14; // member 14 of level 16
+                                                                    int member15; // member 15 of level 16
+                                                                    int member16; // member 16 of level 16
+                                                                    int member17; // member 17 of level 16
+                                                                    int member18; // member 18 of level 16
+                                                                    int member19; // member 19 of level 16
+                                                                    struct Level17 {
+                                                                        int member0; // member 0 of level 17
+                                                                        int member1; // member 1 of level 17
+                                                                        int member2; // member 2 of level 17
+                                                                        int member3; // member 3 of level 17
+                                                                        int member4; // member 4 of level 17
+                                                                        int member5; // member 5 of level 17
+                                                                        int member6; // member 6 of level 17
+                                                                        int member7; // member 7 of level 17
+                                                                        int member8; // member 8 of level 17
+                                                                        int member9; // member 9 of level 17
+                                                                        int member10; // member 10 of level 17
+                                                                        int member11; // member 11 of level 17
+                                                                        int member12; // member 12 of level 17
+                                                                        int member13; // member 13 of level 17
+                                                                        int member14; // member 14 of level 17
+                                                                        int member15; // member 15 of level 17
+                                                                        int member16; // member 16 of level 17
+                                                                        int member17; // member 17 of level 17
+                                                                        int member18; // member 18 of level 17
+                                                                        int member19; // member 19 of level 17
+                                                                        struct Level18 {
+                                                                            int member0; // member 0 of level 18
+                                                                            int member1; // member 1 of level 18
+                                                                            int member2; // member 2 of level 18
+                                                                            int member3; // member 3 of level 18
+                                                                            int member4; // member 4 of level 18
+                                                                            int member5; // member 5 of level 18
+                                                                            int member6; // member 6 of level 18
+                                                                            int member7; // member 7 of level 18
+                                                                            int member8; // member 8 of level 18
+                                                                            int member9; // member 9 of level 18
+                                                                            int member10; // member 10 of level 18
+                                                                            int member11; // member 11 of level 18
+                                                                            int member12; // member 12 of level 18
+                                                                            int member13; // member 13 of level 18
+                                                                            int member14; // member 14 of level 18
+                                                                            int member15; // member 15 of level 18
+                                                                            int member16; // member 16 of level 18
+                                                                            int member17; // member 17 of level 18
+                                                                            int member18; // member 18 of level 18
+                                                                            int member19; // member 19 of level 18
+                                                                            struct Level19 {
+                                                                                int member0; // member 0 of level 19
+                                                                                int member1; // member 1 of level 19
+                                                                                int member2; // member 2 of level 19
+                                                                                int member3; // member 3 of level 19
+                                                                                int member4; // member 4 of level 19
+                                                                                int member5; // member 5 of level 19
+                                                                                int member6; // member 6 of level 19
+                                                                                int member7; // member 7 of level 19
+                                                                                int member8; // member 8 of level 19
+                                                                                int member9; // member 9 of level 19
+                                                                                int member10; // member 10 of level 19
+                                                                                int member11; // member 11 of level 19
+                                                                                int member12; // member 12 of level 19
+                                                                                int member13; // member 13 of level 19
+                                                                                int member14; // member 14 of level 19
+                                                                                int member15; // member 15 of level 19
+                                                                                int member16; // member 16 of level 19
+                                                                                int member17; // member 17 of level 19
+                                                                                int member18; // member 18 of level 19
+                                                                                int member19; // member 19 of level 19
+                                                                                struct Level20 {
+                                                                                    int member0; // member 0 of level 20
+                                                                                    int member1; // member 1 of level 20
+                                                                                    int member2; // member 2 of level 20
+                                                                                    int member3; // member 3 of level 20
+                                                                                    int member4; // member 4 of level 20
+                                                                                    int member5; // member 5 of level 20
+                                                                                    int member6; // member 6 of level 20
+                                                                                    int member7; // member 7 of level 20
+                                                                                    int member8; // member 8 of level 20
+                                                                                    int member9; // member 9 of level 20
+                                                                                    int member10; // member 10 of level 20
+                                                                                    int member11; // member 11 of level 20
+                                                                                    int member12; // member 12 of level 20
+                                                                                    int member13; // member 13 of level 20
+                                                                                    int member14; // member 14 of level 20
+                                                                                    int member15; // member 15 of level 20
+                                                                                    int member16; // member 16 of level 20
+                                                                                    int member17; // member 17 of level 20
+                                                                                    int member18; // member 18 of level 20
+                                                                                    int member19; // member 19 of level 20
+                                                                                    struct Level21 {
+                                                                                        int member0; // member 0 of level 21
+                                                                                        int member1; // member 1 of level 21
+                                                                                        int member2; // member 2 of level 21
+                                                                                        int member3; // member 3 of level 21
+                                                                                        int member4; // member 4 of level 21
+                                                                                        int member5; // member 5 of level 21
+                                                                                        int member6; // member 6 of level 21
+                                                                                        int member7; // member 7 of level 21
+                                                                                        int member8; // member 8 of level 21
+                                                                                        int member9; // member 9 of level 21
+                                                                                        int member10; // member 10 of level 21
+                                                                                        int member11; // member 11 of level 21
+                                                                                        int member12; // member 12 of level 21
+                                                                                        int member13; // member 13 of level 21
+                                                                                        int member14; // member 14 of level 21
+                                                                                        int member15; // member 15 of level 21
+                                                                                        int member16; // member 16 of level 21
+                                                                                        int member17; // member 17 of level 21
+                                                                                        int member18; // member 18 of level 21
+                                                                                        int member19; // member 19 of level 21
+                                                                                        struct Level22 {
+                                                                                            int member0; // member 0 of level 22
+                                                                                            int member1; // member 1 of level 22
+                                                                                            int member2; // member 2 of level 22
+                                                                                            int member3; // member 3 of level 22
+                                                                                            int member4; // member 4 of level 22
+                                                                                            int member5; // member 5 of level 22
+                                                                                            int member6; // member 6 of level 22
+                                                                                            int member7; // member 7 of level 22
+                                                                                            int member8; // member 8 of level 22
+                                                                                            int member9; // member 9 of level 22
+                                                                                            int member10; // member 10 of level 22
+                                                                                            int member11; // member 11 of level 22
+                                                                                            int member12; // member 12 of level 22
+                                                                                            int member13; // member 13 of level 22
+                                                                                            int member14; // member 14 of level 22
+                                                                                            int member15; // member 15 of level 22
+                                                                                            int member16; // member 16 of level 22
+                                                                                            int member17; // member 17 of level 22
+                                                                                            int member18; // member 18 of level 22
+                                                                                            int member19; // member 19 of level 22
+                                                                                            struct Level23 {
+                                                                                                int member0; // member 0 of level 23
+                                                                                                int member1; // member 1 of level 23
+                                                                                                int member2; // member 2 of level 23
+                                                                                                int member3; // member 3 of level 23
+                                                                                                int member4; // member 4 of level 23
+                                                                                                int member5; // member 5 of level 23
+                                                                                                int member6; // member 6 of level 23
+                                                                                                int member7; // member 7 of level 23
+                                                                                                int member8; // member 8 of level 23
+                                                                                                int member9; // member 9 of level 23
+                                                                                                int member10; // member 10 of level 23
+                                                                                                int member11; // member 11 of level 23
+                                                                                                int member12; // member 12 of level 23
+                                                                                                int member13; // member 13 of level 23
+                                                                                                int member14; // member 14 of level 23
+                                                                                                int member15; // member 15 of level 23
+                                                                                                int member16; // member 16 of level 23
+                                                                                                int member17; // member 17 of level 23
+                                                                                                int member18; // member 18 of level 23
+                                                                                                int member19; // member 19 of level 23
+                                                                                                struct Level24 {
+                                                                                                    int member0; // member 0 of level 24
+                                                                                                    int member1; // member 1 of level 24
+                                                                                                    int member2; // member 2 of level 24
+                                                                                                    int member3; // member 3 of level 24
+                                                                                                    int member4; // member 4 of level 24
+                                                                                                    int member5; // member 5 of level 24
+                                                                                                    int member6; // member 6 of level 24
+                                                                                                    int member7; // member 7 of level 24
+                                                                                                    int member8; // member 8 of level 24
+                                                                                                    int member9; // member 9 of level 24
+                                                                                                    int member10; // member 10 of level 24
+                                                                                                    int member11; // member 11 of level 24
+                                                                                                    int member12; // member 12 of level 24
+                                                                                                    int member13; // member 13 of level 24
+                                                                                                    int member14; // member 14 of level 24
+                                                                                                    int member15; // member 15 of level 24
+                                                                                                    int member16; // member 16 of level 24
+                                                                                                    int member17; // member 17 of level 24
+                                                                                                    int member18; // member 18 of level 24
+                                                                                                    int member19; // member 19 of level 24
+                                                                                                    struct Level25 {
+                                                                                                        int member0; // member 0 of level 25
+                                                                                                        int member1; // member 1 of level 25
+                                                                                                        int member2; // member 2 of level 25
+                                                                                                        int member3; // member 3 of level 25
+                                                                                                        int member4; // member 4 of level 25
+                                                                                                        int member5; // member 5 of level 25
+                                                                                                        int member6; // member 6 of level 25
+                                                                                                        int member7; // member 7 of level 25
+                                                                                                        int member8; // member 8 of level 25
+                                                                                                        int member9; // member 9 of level 25
+                                                                                                        int member10; // member 10 of level 25
+                                                                                                        int member11; // member 11 of level 25
+                                                                                                        int member12; // member 12 of level 25
+                                                                                                        int member13; // member 13 of level 25
+                                                                                                        int member14; // member 14 of level 25
+                                                                                                        int member15; // member 15 of level 25
+                                                                                                        int member16; // member 16 of level 25
+                                                                                                        int member17; // member 17 of level 25
+                                                                                                        int member18; // member 18 of level 25
+                                                                                                        int member19; // member 19 of level 25
+                                                                                                        struct Level26 {
+                                                                                                            int member0; // member 0 of level 26
+                                                                                                            int member1; // member 1 of level 26
+                                                                                                            int member2; // member 2 of level 26
+                                                                                                            int member3; // member 3 of level 26
+                                                                                                            int member4; // member 4 of level 26
+                                                                                                            int member5; // member 5 of level 26
+                                                                                                            int member6; // member 6 of level 26
+                                                                                                            int member7; // member 7 of level 26
+                                                                                                            int member8; // member 8 of level 26
+                                                                                                            int member9; // member 9 of level 26
+                                                                                                            int member10; // member 10 of level 26
+                                                                                                            int member11; // member 11 of level 26
+                                                                                                            int member12; // member 12 of level 26
+                                                                                                            int member13; // member 13 of level 26
+                                                                                                            int member14; // member 14 of level 26
+                                                                                                            int member15; // member 15 of level 26
+                                                                                                            int member16; // member 16 of level 26
+                                                                                                            int member17; // member 17 of level 26
+                                                                                                            int member18; // member 18 of level 26
+                                                                                                            int member19; // member 19 of level 26
+                                                                                                            struct Level27 {
+                                                                                                                int member0; // member 0 of level 27
+                                                                                                                int member1; // member 1 of level 27
+                                                                                                                int member2; // member 2 of level 27
+                                                                                                                int member3; // member 3 of level 27
+                                                                                                                int member4; // member 4 of level 27
+                                                                                                                int member5; // member 5 of level 27
+                                                                                                                int member6; // member 6 of level 27
+                                                                                                                int member7; // member 7 of level 27
+                                                                                                                int member8; // member 8 of level 27
+                                                                                                                int member9; // member 9 of level 27
+                                                                                                                int member10; // member 10 of level 27
+                                                                                                                int member11; // member 11 of level 27
+                                                                                                                int member12; // member 12 of level 27
+                                                                                                                int member13; // member 13 of level 27
+                                                                                                                int member14; // member 14 of level 27
+                                                                                                                int member15; // member 15 of level 27
+                                                                                                                int member16; // member 16 of level 27
+                                                                                                                int member17; // member 17 of level 27
+                                                                                                                int member18; // member 18 of level 27
+                                                                                                                int member19; // member 19 of level 27
+                                                                                                                struct Level28 {
+                                                                                                                    int member0; // member 0 of level 28
+                                                                                                                    int member1; // member 1 of level 28
+                                                                                                                    int member2; // member 2 of level 28
+                                                                                                                    int member3; // member 3 of level 28
+                                                                                                                    int member4; // member 4 of level 28
+                                                                                                                    int member5; // member 5 of level 28
+                                                                                                                    int member6; // member 6 of level 28
+                                                                                                                    int member7; // member 7 of level 28
+                                                                                                                    int member8; // member 8 of level 28
+                                                                                                                    int member9; // member 9 of level 28
+                                                                                                                    int member10; // member 10 of level 28
+                                                                                                                    int member11; // member 11 of level 28
+                                                                                                                    int member12; // member 12 of level 28
+                                                                                                                    int member13; // member 13 of level 28
+                                                                                                                    int member14; // member 14 of level 28
+                                                                                                                    int member15; // member 15 of level 28
+                                                                                                                    int member16; // member 16 of level 28
+                                                                                                                    int member17; // member 17 of level 28
+                                                                                                                    int member18; // member 18 of level 28
+                                                                                                                    int member19; // member 19 of level 28
+                                                                                                                    struct Level29 {
+                                                                                                                        int member0; // member 0 of level 29
+                                                                                                                        int member1; // member 1 of level 29
+                                                                                                                        int member2; // member 2 of level 29
+                                                                                                                        int member3; // member 3 of level 29
+                                                                                                                        int member4; // member 4 of level 29
+                                                                                                                        int member5; // member 5 of level 29
+                                                                                                                        int member6; // member 6 of level 29
+                                                                                                                        int member7; // member 7 of level 29
+                                                                                                                        int member8; // member 8 of level 29
+                                                                                                                        int member9; // member 9 of level 29
+                                                                                                                        int member10; // member 10 of level 29
+                                                                                                                        int member11; // member 11 of level 29
+                                                                                                                        int member12; // member 12 of level 29
+                                                                                                                        int member13; // member 13 of level 29
+                                                                                                                        int member14; // member 14 of level 29
+                                                                                                                        int member15; // member 15 of level 29
+                                                                                                                        int member16; // member 16 of level 29
+                                                                                                                        int member17; // member 17 of level 29
+                                                                                                                        int member18; // member 18 of level 29
+                                                                                                                        int member19; // member 19 of level 29
+                                                                                                                        struct Level30 {
+                                                                                                                            int member0; // member 0 of level 30
+                                                                                                                            int member1; // member 1 of level 30
+                                                                                                                            int member2; // member 2 of level 30
+                                                                                                                            int member3; // member 3 of level 30
+                                                                                                                            int member4; // member 4 of level 30
+                                                                                                                            int member5; // member 5 of level 30
+                                                                                                                            int member6; // member 6 of level 30
+                                                                                                                            int member7; // member 7 of level 30
+                                                                                                                            int member8; // member 8 of level 30
+                                                                                                                            int member9; // member 9 of level 30
+                                                                                                                            int member10; // member 10 of level 30
+                                                                                                                            int member11; // member 11 of level 30
+                                                                                                                            int member12; // member 12 of level 30
+                                                                                                                            int member13; // member 13 of level 30
+                                                                                                                            int member14; // member 14 of level 30
+                                                                                                                            int member15; // member 15 of level 30
+                                                                                                                            int member16; // member 16 of level 30
+                                                                                                                            int member17; // member 17 of level 30
+                                                                                                                            int member18; // member 18 of level 30
+                                                                                                                            int member19; // member 19 of level 30
+                                                                                                                            struct Level31 {
+                                                                                                                                int member0; // member 0 of level 31
+                                                                                                                                int member1; // member 1 of level 31
+                                                                                                                                int member2; // member 2 of level 31
+                                                                                                                                int member3; // member 3 of level 31
+                                                                                                                                int member4; // member 4 of level 31
+                                                                                                                                int member5; // member 5 of level 31
+                                                                                                                                int member6; // member 6 of level 31
+                                                                                                                                int member7; // member 7 of level 31
+                                                                                                                                int member8; // member 8 of level 31
+                                                                                                                                int member9; // member 9 of level 31
+                                                                                                                                int member10; // member 10 of level 31
+                                                                                                                                int member11; // member 11 of level 31
+                                                                                                                                int member12; // member 12 of level 31
+                                                                                                                                int member13; // member 13 of level 31
+                                                                                                                                int member14; // member 14 of level 31
+                                                                                                                                int member15; // member 15 of level 31
+                                                                                                                                int member16; // member 16 of level 31
+                                                                                                                                int member17; // member 17 of level 31
+                                                                                                                                int member18; // member 18 of level 31
+                                                                                                                                int member19; // member 19 of level 31
+                                                                                                                                struct Level32 {
+                                                                                                                                    int member0; // member 0 of level 32
+                                                                                                                                    int member1; // member 1 of level 32
+                                                                                                                                    int member2; // member 2 of level 32
+                                                                                                                                    int member3; // member 3 of level 32
+                                                                                                                                    int member4; // member 4 of level 32
+                                                                                                                                    int member5; // member 5 of level 32
+                                                                                                                                    int member6; // member 6 of level 32
+                                                                                                                                    int member7; // member 7 of level 32
+                                                                                                                                    int member8; // member 8 of level 32
+                                                                                                                                    int member9; // member 9 of level 32
+                                                                                                                                    int member10; // member 10 of level 32
+                                                                                                                                    int member11; // member 11 of level 32
+                                                                                                                                    int member12; // member 12 of level 32
+                                                                                                                                    int member13; // member 13 of level 32
+                                                                                                                                    int member14; // member 14 of level 32
+                                                                                                                                    int member15; // member 15 of level 32
+                                                                                                                                    int member16; // member 16 of level 32
+                                                                                                                                    int member17; // member 17 of level 32
+                                                                                                                                    int member18; // member 18 of level 32
+                                                                                                                                    int member19; // member 19 of level 32
+                                                                                                                                    struct Level33 {
+                                                                                                                                        int member0; // member 0 of level 33
+                                                                                                                                        int member1; // member 1 of level 33
+                                                                                                                                        int member2; // member 2 of level 33
+                                                                                                                                        int member3; // member 3 of level 33
+                                                                                                                                        int member4; // member 4 of level 33
+                                                                                                                                        int member5; // member 5 of level 33
+                                                                                                                                        int member6; // member 6 of level 33
+                                                                                                                                        int member7; // member 7 of level 33
+                                                                                                                                        int member8; // member 8 of level 33
+                                                                                                                                        int member9; // member 9 of level 33
+                                                                                                                                        int member10; // member 10 of level 33
+                                                                                                                                        int member11; // member 11 of level 33
+                                                                                                                                        int member12; // member 12 of level 33
+                                                                                                                                        int member13; // member 13 of level 33
+                                                                                                                                        int member14; // member 14 of level 33
+                                                                                                                                        int member15; // member 15 of level 33
+                                                                                                                                        int member16; // member 16 of level 33
+                                                                                                                                        int member17; // member 17 of level 33
+                                                                                                                                        int member18; // member 18 of level 33
+                                                                                                                                        int member19; // member 19 of level 33
+                                                                                                                                        struct Level34 {
+                                                                                                                                            int member0; // member 0 of level 34
+                                                                                                                                            int member1; // member 1 of level 34
+                                                                                                                                            int member2; // member 2 of level 34
+                                                                                                                                            int member3; // member 3 of level 34
+                                                                                                                                            int member4; // member 4 of level 34
+                                                                                                                                            int member5; // member 5 of level 34
+                                                                                                                                            int member6; // member 6 of level 34
+                                                                                                                                            int member7; // member 7 of level 34
+                                                                                                                                            int member8; // member 8 of level 34
+                                                                                                                                            int member9; // member 9 of level 34
+                                                                                                                                            int member10; // member 10 of level 34
+                                                                                                                                            int member11; // member 11 of level 34
+                                                                                                                                            int member12; // member 12 of level 34
+                                                                                                                                            int member13; // member 13 of level 34
+                                                                                                                                            int member14; // member 14 of level 34
+                                                                                                                                            int member15; // member 15 of level 34
+                                                                                                                                            int member16; // member 16 of level 34
+                                                                                                                                            int member17; // member 17 of level 34
+                                                                                                                                            int member18; // member 18 of level 34
+                                                                                                                                            int member19; // member 19 of level 34
+                                                                                                                                            struct Level35 {
+                                                                                                                                                int member0; // member 0 of level 35
+                                                                                                                                                int member1; // member 1 of level 35
+                                                                                                                                                int member2; // member 2 of level 35
+                                                                                                                                                int member3; // member 3 of level 35
+                                                                                                                                                int member4; // member 4 of level 35
+                                                                                                                                                int member5; // member 5 of level 35
+                                                                                                                                                int member6; // member 6 of level 35
+                                                                                                                                                int member7; // member 7 of level 35
+                                                                                                                                                int member8; // member 8 of level 35
+                                                                                                                                                int member9; // member 9 of level 35
+                                                                                                                                                int member10; // member 10 of level 35
+                                                                                                                                                int member11; // member 11 of level 35
+                                                                                                                                                int member12; // member 12 of level 35
+                                                                                                                                                int member13; // member 13 of level 35
+                                                                                                                                                int member14; // member 14 of level 35
+                                                                                                                                                int member15; // member 15 of level 35
+                                                                                                                                                int member16; // member 16 of level 35
+                                                                                                                                                int member17; // member 17 of level 35
+                                                                                                                                                int member18; // member 18 of level 35
+                                                                                                                                                int member19; // member 19 of level 35
+                                                                                                                                                struct Level36 {
+                                                                                                                                                    int member0; // member 0 of level 36
+                                                                                                                                                    int member1; // member 1 of level 36
+                                                                                                                                                    int member2; // member 2 of level 36
+                                                                                                                                                    int member3; // member 3 of level 36
+                                                                                                                                                    int member4; // member 4 of level 36
+                                                                                                                                                    int member5; // member 5 of level 36
+                                                                                                                                                    int member6; // member 6 of level 36
+                                                                                                                                                    int member7; // member 7 of level 36
+                                                                                                                                                    int member8; // member 8 of level 36
+                                                                                                                                                    int member9; // member 9 of level 36
+                                                                                                                                                    int member10; // member 10 of level 36
+                                                                                                                                                    int member11; // member 11 of level 36
+                                                                                                                                                    int member12; // member 12 of level 36
+                                                                                                                                                    int member13; // member 13 of level 36
+                                                                                                                                                    int member14; // member 14 of level 36
+                                                                                                                                                    int member15; // member 15 of level 36
+                                                                                                                                                    int member16; // member 16 of level 36
+                                                                                                                                                    int member17; // member 17 of level 36
+                                                                                                                                                    int member18; // member 18 of level 36
+                                                                                                                                                    int member19; // member 19 of level 36
+                                                                                                                                                    struct Level37 {
+                                                                                                                                                        int member0; // member 0 of level 37
+                                                                                                                                                        int member1; // member 1 of level 37
+                                                                                                                                                        int member2; // member 2 of level 37
+                                                                                                                                                        int member3; // member 3 of level 37
+                                                                                                                                                        int member4; // member 4 of level 37
+                                                                                                                                                        int member5; // member 5 of level 37
+                                                                                                                                                        int member6; // member 6 of level 37
+                                                                                                                                                        int member7; // member 7 of level 37
+                                                                                                                                                        int member8; // member 8 of level 37
+                                                                                                                                                        int member9; // member 9 of level 37
+                                                                                                                                                        int member10; // member 10 of level 37
+                                                                                                                                                        int member11; // member 11 of level 37
+                                                                                                                                                        int member12; // member 12 of level 37
+                                                                                                                                                        int member13; // member 13 of level 37
+                                                                                                                                                        int member14; // member 14 of level 37
+                                                                                                                                                        int member15; // member 15 of level 37
+                                                                                                                                                        int member16; // member 16 of level 37
+                                                                                                                                                        int member17; // member 17 of level 37
+                                                                                                                                                        int member18; // member 18 of level 37
+                                                                                                                                                        int member19; // member 19 of level 37
+                                                                                                                                                        struct Level38 {
+                                                                                                                                                            int member0; // member 0 of level 38
+                                                                                                                                                            int member1; // member 1 of level 38
+                                                                                                                                                            int member2; // member 2 of level 38
+                                                                                                                                                            int member3; // member 3 of level 38
+                                                                                                                                                            int member4; // member 4 of level 38
+                                                                                                                                                            int member5; // member 5 of level 38
+                                                                                                                                                            int member6; // member 6 of level 38
+                                                                                                                                                            int member7; // member 7 of level 38
+                                                                                                                                                            int member8; // member 8 of level 38
+                                                                                                                                                            int member9; // member 9 of level 38
+                                                                                                                                                            int member10; // member 10 of level 38
+                                                                                                                                                            int member11; // member 11 of level 38
+                                                                                                                                                            int member12; // member 12 of level 38
+                                                                                                                                                            int member13; // member 13 of level 38
+                                                                                                                                                            int member14; // member 14 of level 38
+                                                                                                                                                            int member15; // member 15 of level 38
+                                                                                                                                                            int member16; // member 16 of level 38
+                                                                                                                                                            int member17; // member 17 of level 38
+                                                                                                                                                            int member18; // member 18 of level 38
+                                                                                                                                                            int member19; // member 19 of level 38
+                                                                                                                                                            struct Level39 {
+                                                                                                                                                                int member0; // member 0 of level 39
+                                                                                                                                                                int member1; // member 1 of level 39
+                                                                                                                                                                int member2; // member 2 of level 39
+                                                                                                                                                                int member3; // member 3 of level 39
+                                                                                                                                                                int member4; // member 4 of level 39
+                                                                                                                                                                int member5; // member 5 of level 39
+                                                                                                                                                                int member6; // member 6 of level 39
+                                                                                                                                                                int member7; // member 7 of level 39
+                                                                                                                                                                int member8; // member 8 of level 39
+                                                                                                                                                                int member9; // member 9 of level 39
+                                                                                                                                                                int member10; // member 10 of level 39
+                                                                                                                                                                int member11; // member 11 of level 39
+                                                                                                                                                                int member12; // member 12 of level 39
+                                                                                                                                                                int member13; // member 13 of level 39
+                                                                                                                                                                int member14; // member 14 of level 39
+                                                                                                                                                                int member15; // member 15 of level 39
+                                                                                                                                                                int member16; // member 16 of level 39
+                                                                                                                                                                int member17; // member 17 of level 39
+                                                                                                                                                                int member18; // member 18 of level 39
+                                                                                                                                                                int member19; // member 19 of level 39
+                                                                                                                                                            } level39;
+                                                                                                                                                        } level38;
+                                                                                                                                                    } level37;
+                                                                                                                                                } level36;
+                                                                                                                                            } level35;
+                                                                                                                                        } level34;
+                                                                                                                                    } level33;
+                                                                                                                                } level32;
+                                                                                                                            } level31;
+                                                                                                                        } level30;
+                                                                                                                    } level29;
+                                                                                                                } level28;
+                                                                                                            } level27;
+                                                                                                        } level26;
+                                                                                                    } level25;
+                                                                                                } level24;
+                                                                                            } level23;
+                                                                                        } level22;
+                                                                                    } level21;
+                                                                                } level20;
+                                                                            } level19;
+                                                                        } level18;
+                                                                    } level17;
+                                                                } level16;
+                                                            } level15;
+                                                        } level14;
+                                                    } level13;
+                                                } level12;
+                                            } level11;
+                                        } level10;
+                                    } level9;
+                                } level8;
+                            } level7;
+                        } level6;
+                    } level5;
+                } level4;
+            } level3;
+        } level2;
+    } level1;
+} level0;
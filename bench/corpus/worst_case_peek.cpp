@@ -0,0 +1,2418 @@
+// Worst case for the look ahead of peekNextText().
+// Each comment line in a switch statement checks for a header following the comment.
+// The blank lines between the comments do not end the search, so without the cache
+// the remaining comments are searched again for each comment line.
+
+int worstCasePeek(int value)
+{
+    switch (value)
+    {
+    case 1:
+        value++;
+        // comment 1 of a long run of comments separated by blank lines
+
+        // comment 2 of a long run of comments separated by blank lines
+
+        // comment 3 of a long run of comments separated by blank lines
+
+        // comment 4 of a long run of comments separated by blank lines
+
+        // comment 5 of a long run of comments separated by blank lines
+
+        // comment 6 of a long run of comments separated by blank lines
+
+        // comment 7 of a long run of comments separated by blank lines
+
+        // comment 8 of a long run of comments separated by blank lines
+
+        // comment 9 of a long run of comments separated by blank lines
+
+        // comment 10 of a long run of comments separated by blank lines
+
+        // comment 11 of a long run of comments separated by blank lines
+
+        // comment 12 of a long run of comments separated by blank lines
+
+        // comment 13 of a long run of comments separated by blank lines
+
+        // comment 14 of a long run of comments separated by blank lines
+
+        // comment 15 of a long run of comments separated by blank lines
+
+        // comment 16 of a long run of comments separated by blank lines
+
+        // comment 17 of a long run of comments separated by blank lines
+
+        // comment 18 of a long run of comments separated by blank lines
+
+        // comment 19 of a long run of comments separated by blank lines
+
+        // comment 20 of a long run of comments separated by blank lines
+
+        // comment 21 of a long run of comments separated by blank lines
+
+        // comment 22 of a long run of comments separated by blank lines
+
+        // comment 23 of a long run of comments separated by blank lines
+
+        // comment 24 of a long run of comments separated by blank lines
+
+        // comment 25 of a long run of comments separated by blank lines
+
+        // comment 26 of a long run of comments separated by blank lines
+
+        // comment 27 of a long run of comments separated by blank lines
+
+        // comment 28 of a long run of comments separated by blank lines
+
+        // comment 29 of a long run of comments separated by blank lines
+
+        // comment 30 of a long run of comments separated by blank lines
+
+        // comment 31 of a long run of comments separated by blank lines
+
+        // comment 32 of a long run of comments separated by blank lines
+
+        // comment 33 of a long run of comments separated by blank lines
+
+        // comment 34 of a long run of comments separated by blank lines
+
+        // comment 35 of a long run of comments separated by blank lines
+
+        // comment 36 of a long run of comments separated by blank lines
+
+        // comment 37 of a long run of comments separated by blank lines
+
+        // comment 38 of a long run of comments separated by blank lines
+
+        // comment 39 of a long run of comments separated by blank lines
+
+        // comment 40 of a long run of comments separated by blank lines
+
+        // comment 41 of a long run of comments separated by blank lines
+
+        // comment 42 of a long run of comments separated by blank lines
+
+        // comment 43 of a long run of comments separated by blank lines
+
+        // comment 44 of a long run of comments separated by blank lines
+
+        // comment 45 of a long run of comments separated by blank lines
+
+        // comment 46 of a long run of comments separated by blank lines
+
+        // comment 47 of a long run of comments separated by blank lines
+
+        // comment 48 of a long run of comments separated by blank lines
+
+        // comment 49 of a long run of comments separated by blank lines
+
+        // comment 50 of a long run of comments separated by blank lines
+
+        // comment 51 of a long run of comments separated by blank lines
+
+        // comment 52 of a long run of comments separated by blank lines
+
+        // comment 53 of a long run of comments separated by blank lines
+
+        // comment 54 of a long run of comments separated by blank lines
+
+        // comment 55 of a long run of comments separated by blank lines
+
+        // comment 56 of a long run of comments separated by blank lines
+
+        // comment 57 of a long run of comments separated by blank lines
+
+        // comment 58 of a long run of comments separated by blank lines
+
+        // comment 59 of a long run of comments separated by blank lines
+
+        // comment 60 of a long run of comments separated by blank lines
+
+        // comment 61 of a long run of comments separated by blank lines
+
+        // comment 62 of a long run of comments separated by blank lines
+
+        // comment 63 of a long run of comments separated by blank lines
+
+        // comment 64 of a long run of comments separated by blank lines
+
+        // comment 65 of a long run of comments separated by blank lines
+
+        // comment 66 of a long run of comments separated by blank lines
+
+        // comment 67 of a long run of comments separated by blank lines
+
+        // comment 68 of a long run of comments separated by blank lines
+
+        // comment 69 of a long run of comments separated by blank lines
+
+        // comment 70 of a long run of comments separated by blank lines
+
+        // comment 71 of a long run of comments separated by blank lines
+
+        // comment 72 of a long run of comments separated by blank lines
+
+        // comment 73 of a long run of comments separated by blank lines
+
+        // comment 74 of a long run of comments separated by blank lines
+
+        // comment 75 of a long run of comments separated by blank lines
+
+        // comment 76 of a long run of comments separated by blank lines
+
+        // comment 77 of a long run of comments separated by blank lines
+
+        // comment 78 of a long run of comments separated by blank lines
+
+        // comment 79 of a long run of comments separated by blank lines
+
+        // comment 80 of a long run of comments separated by blank lines
+
+        // comment 81 of a long run of comments separated by blank lines
+
+        // comment 82 of a long run of comments separated by blank lines
+
+        // comment 83 of a long run of comments separated by blank lines
+
+        // comment 84 of a long run of comments separated by blank lines
+
+        // comment 85 of a long run of comments separated by blank lines
+
+        // comment 86 of a long run of comments separated by blank lines
+
+        // comment 87 of a long run of comments separated by blank lines
+
+        // comment 88 of a long run of comments separated by blank lines
+
+        // comment 89 of a long run of comments separated by blank lines
+
+        // comment 90 of a long run of comments separated by blank lines
+
+        // comment 91 of a long run of comments separated by blank lines
+
+        // comment 92 of a long run of comments separated by blank lines
+
+        // comment 93 of a long run of comments separated by blank lines
+
+        // comment 94 of a long run of comments separated by blank lines
+
+        // comment 95 of a long run of comments separated by blank lines
+
+        // comment 96 of a long run of comments separated by blank lines
+
+        // comment 97 of a long run of comments separated by blank lines
+
+        // comment 98 of a long run of comments separated by blank lines
+
+        // comment 99 of a long run of comments separated by blank lines
+
+        // comment 100 of a long run of comments separated by blank lines
+
+        // comment 101 of a long run of comments separated by blank lines
+
+        // comment 102 of a long run of comments separated by blank lines
+
+        // comment 103 of a long run of comments separated by blank lines
+
+        // comment 104 of a long run of comments separated by blank lines
+
+        // comment 105 of a long run of comments separated by blank lines
+
+        // comment 106 of a long run of comments separated by blank lines
+
+        // comment 107 of a long run of comments separated by blank lines
+
+        // comment 108 of a long run of comments separated by blank lines
+
+        // comment 109 of a long run of comments separated by blank lines
+
+        // comment 110 of a long run of comments separated by blank lines
+
+        // comment 111 of a long run of comments separated by blank lines
+
+        // comment 112 of a long run of comments separated by blank lines
+
+        // comment 113 of a long run of comments separated by blank lines
+
+        // comment 114 of a long run of comments separated by blank lines
+
+        // comment 115 of a long run of comments separated by blank lines
+
+        // comment 116 of a long run of comments separated by blank lines
+
+        // comment 117 of a long run of comments separated by blank lines
+
+        // comment 118 of a long run of comments separated by blank lines
+
+        // comment 119 of a long run of comments separated by blank lines
+
+        // comment 120 of a long run of comments separated by blank lines
+
+        // comment 121 of a long run of comments separated by blank lines
+
+        // comment 122 of a long run of comments separated by blank lines
+
+        // comment 123 of a long run of comments separated by blank lines
+
+        // comment 124 of a long run of comments separated by blank lines
+
+        // comment 125 of a long run of comments separated by blank lines
+
+        // comment 126 of a long run of comments separated by blank lines
+
+        // comment 127 of a long run of comments separated by blank lines
+
+        // comment 128 of a long run of comments separated by blank lines
+
+        // comment 129 of a long run of comments separated by blank lines
+
+        // comment 130 of a long run of comments separated by blank lines
+
+        // comment 131 of a long run of comments separated by blank lines
+
+        // comment 132 of a long run of comments separated by blank lines
+
+        // comment 133 of a long run of comments separated by blank lines
+
+        // comment 134 of a long run of comments separated by blank lines
+
+        // comment 135 of a long run of comments separated by blank lines
+
+        // comment 136 of a long run of comments separated by blank lines
+
+        // comment 137 of a long run of comments separated by blank lines
+
+        // comment 138 of a long run of comments separated by blank lines
+
+        // comment 139 of a long run of comments separated by blank lines
+
+        // comment 140 of a long run of comments separated by blank lines
+
+        // comment 141 of a long run of comments separated by blank lines
+
+        // comment 142 of a long run of comments separated by blank lines
+
+        // comment 143 of a long run of comments separated by blank lines
+
+        // comment 144 of a long run of comments separated by blank lines
+
+        // comment 145 of a long run of comments separated by blank lines
+
+        // comment 146 of a long run of comments separated by blank lines
+
+        // comment 147 of a long run of comments separated by blank lines
+
+        // comment 148 of a long run of comments separated by blank lines
+
+        // comment 149 of a long run of comments separated by blank lines
+
+        // comment 150 of a long run of comments separated by blank lines
+
+        // comment 151 of a long run of comments separated by blank lines
+
+        // comment 152 of a long run of comments separated by blank lines
+
+        // comment 153 of a long run of comments separated by blank lines
+
+        // comment 154 of a long run of comments separated by blank lines
+
+        // comment 155 of a long run of comments separated by blank lines
+
+        // comment 156 of a long run of comments separated by blank lines
+
+        // comment 157 of a long run of comments separated by blank lines
+
+        // comment 158 of a long run of comments separated by blank lines
+
+        // comment 159 of a long run of comments separated by blank lines
+
+        // comment 160 of a long run of comments separated by blank lines
+
+        // comment 161 of a long run of comments separated by blank lines
+
+        // comment 162 of a long run of comments separated by blank lines
+
+        // comment 163 of a long run of comments separated by blank lines
+
+        // comment 164 of a long run of comments separated by blank lines
+
+        // comment 165 of a long run of comments separated by blank lines
+
+        // comment 166 of a long run of comments separated by blank lines
+
+        // comment 167 of a long run of comments separated by blank lines
+
+        // comment 168 of a long run of comments separated by blank lines
+
+        // comment 169 of a long run of comments separated by blank lines
+
+        // comment 170 of a long run of comments separated by blank lines
+
+        // comment 171 of a long run of comments separated by blank lines
+
+        // comment 172 of a long run of comments separated by blank lines
+
+        // comment 173 of a long run of comments separated by blank lines
+
+        // comment 174 of a long run of comments separated by blank lines
+
+        // comment 175 of a long run of comments separated by blank lines
+
+        // comment 176 of a long run of comments separated by blank lines
+
+        // comment 177 of a long run of comments separated by blank lines
+
+        // comment 178 of a long run of comments separated by blank lines
+
+        // comment 179 of a long run of comments separated by blank lines
+
+        // comment 180 of a long run of comments separated by blank lines
+
+        // comment 181 of a long run of comments separated by blank lines
+
+        // comment 182 of a long run of comments separated by blank lines
+
+        // comment 183 of a long run of comments separated by blank lines
+
+        // comment 184 of a long run of comments separated by blank lines
+
+        // comment 185 of a long run of comments separated by blank lines
+
+        // comment 186 of a long run of comments separated by blank lines
+
+        // comment 187 of a long run of comments separated by blank lines
+
+        // comment 188 of a long run of comments separated by blank lines
+
+        // comment 189 of a long run of comments separated by blank lines
+
+        // comment 190 of a long run of comments separated by blank lines
+
+        // comment 191 of a long run of comments separated by blank lines
+
+        // comment 192 of a long run of comments separated by blank lines
+
+        // comment 193 of a long run of comments separated by blank lines
+
+        // comment 194 of a long run of comments separated by blank lines
+
+        // comment 195 of a long run of comments separated by blank lines
+
+        // comment 196 of a long run of comments separated by blank lines
+
+        // comment 197 of a long run of comments separated by blank lines
+
+        // comment 198 of a long run of comments separated by blank lines
+
+        // comment 199 of a long run of comments separated by blank lines
+
+        // comment 200 of a long run of comments separated by blank lines
+
+        // comment 201 of a long run of comments separated by blank lines
+
+        // comment 202 of a long run of comments separated by blank lines
+
+        // comment 203 of a long run of comments separated by blank lines
+
+        // comment 204 of a long run of comments separated by blank lines
+
+        // comment 205 of a long run of comments separated by blank lines
+
+        // comment 206 of a long run of comments separated by blank lines
+
+        // comment 207 of a long run of comments separated by blank lines
+
+        // comment 208 of a long run of comments separated by blank lines
+
+        // comment 209 of a long run of comments separated by blank lines
+
+        // comment 210 of a long run of comments separated by blank lines
+
+        // comment 211 of a long run of comments separated by blank lines
+
+        // comment 212 of a long run of comments separated by blank lines
+
+        // comment 213 of a long run of comments separated by blank lines
+
+        // comment 214 of a long run of comments separated by blank lines
+
+        // comment 215 of a long run of comments separated by blank lines
+
+        // comment 216 of a long run of comments separated by blank lines
+
+        // comment 217 of a long run of comments separated by blank lines
+
+        // comment 218 of a long run of comments separated by blank lines
+
+        // comment 219 of a long run of comments separated by blank lines
+
+        // comment 220 of a long run of comments separated by blank lines
+
+        // comment 221 of a long run of comments separated by blank lines
+
+        // comment 222 of a long run of comments separated by blank lines
+
+        // comment 223 of a long run of comments separated by blank lines
+
+        // comment 224 of a long run of comments separated by blank lines
+
+        // comment 225 of a long run of comments separated by blank lines
+
+        // comment 226 of a long run of comments separated by blank lines
+
+        // comment 227 of a long run of comments separated by blank lines
+
+        // comment 228 of a long run of comments separated by blank lines
+
+        // comment 229 of a long run of comments separated by blank lines
+
+        // comment 230 of a long run of comments separated by blank lines
+
+        // comment 231 of a long run of comments separated by blank lines
+
+        // comment 232 of a long run of comments separated by blank lines
+
+        // comment 233 of a long run of comments separated by blank lines
+
+        // comment 234 of a long run of comments separated by blank lines
+
+        // comment 235 of a long run of comments separated by blank lines
+
+        // comment 236 of a long run of comments separated by blank lines
+
+        // comment 237 of a long run of comments separated by blank lines
+
+        // comment 238 of a long run of comments separated by blank lines
+
+        // comment 239 of a long run of comments separated by blank lines
+
+        // comment 240 of a long run of comments separated by blank lines
+
+        // comment 241 of a long run of comments separated by blank lines
+
+        // comment 242 of a long run of comments separated by blank lines
+
+        // comment 243 of a long run of comments separated by blank lines
+
+        // comment 244 of a long run of comments separated by blank lines
+
+        // comment 245 of a long run of comments separated by blank lines
+
+        // comment 246 of a long run of comments separated by blank lines
+
+        // comment 247 of a long run of comments separated by blank lines
+
+        // comment 248 of a long run of comments separated by blank lines
+
+        // comment 249 of a long run of comments separated by blank lines
+
+        // comment 250 of a long run of comments separated by blank lines
+
+        // comment 251 of a long run of comments separated by blank lines
+
+        // comment 252 of a long run of comments separated by blank lines
+
+        // comment 253 of a long run of comments separated by blank lines
+
+        // comment 254 of a long run of comments separated by blank lines
+
+        // comment 255 of a long run of comments separated by blank lines
+
+        // comment 256 of a long run of comments separated by blank lines
+
+        // comment 257 of a long run of comments separated by blank lines
+
+        // comment 258 of a long run of comments separated by blank lines
+
+        // comment 259 of a long run of comments separated by blank lines
+
+        // comment 260 of a long run of comments separated by blank lines
+
+        // comment 261 of a long run of comments separated by blank lines
+
+        // comment 262 of a long run of comments separated by blank lines
+
+        // comment 263 of a long run of comments separated by blank lines
+
+        // comment 264 of a long run of comments separated by blank lines
+
+        // comment 265 of a long run of comments separated by blank lines
+
+        // comment 266 of a long run of comments separated by blank lines
+
+        // comment 267 of a long run of comments separated by blank lines
+
+        // comment 268 of a long run of comments separated by blank lines
+
+        // comment 269 of a long run of comments separated by blank lines
+
+        // comment 270 of a long run of comments separated by blank lines
+
+        // comment 271 of a long run of comments separated by blank lines
+
+        // comment 272 of a long run of comments separated by blank lines
+
+        // comment 273 of a long run of comments separated by blank lines
+
+        // comment 274 of a long run of comments separated by blank lines
+
+        // comment 275 of a long run of comments separated by blank lines
+
+        // comment 276 of a long run of comments separated by blank lines
+
+        // comment 277 of a long run of comments separated by blank lines
+
+        // comment 278 of a long run of comments separated by blank lines
+
+        // comment 279 of a long run of comments separated by blank lines
+
+        // comment 280 of a long run of comments separated by blank lines
+
+        // comment 281 of a long run of comments separated by blank lines
+
+        // comment 282 of a long run of comments separated by blank lines
+
+        // comment 283 of a long run of comments separated by blank lines
+
+        // comment 284 of a long run of comments separated by blank lines
+
+        // comment 285 of a long run of comments separated by blank lines
+
+        // comment 286 of a long run of comments separated by blank lines
+
+        // comment 287 of a long run of comments separated by blank lines
+
+        // comment 288 of a long run of comments separated by blank lines
+
+        // comment 289 of a long run of comments separated by blank lines
+
+        // comment 290 of a long run of comments separated by blank lines
+
+        // comment 291 of a long run of comments separated by blank lines
+
+        // comment 292 of a long run of comments separated by blank lines
+
+        // comment 293 of a long run of comments separated by blank lines
+
+        // comment 294 of a long run of comments separated by blank lines
+
+        // comment 295 of a long run of comments separated by blank lines
+
+        // comment 296 of a long run of comments separated by blank lines
+
+        // comment 297 of a long run of comments separated by blank lines
+
+        // comment 298 of a long run of comments separated by blank lines
+
+        // comment 299 of a long run of comments separated by blank lines
+
+        // comment 300 of a long run of comments separated by blank lines
+
+        // comment 301 of a long run of comments separated by blank lines
+
+        // comment 302 of a long run of comments separated by blank lines
+
+        // comment 303 of a long run of comments separated by blank lines
+
+        // comment 304 of a long run of comments separated by blank lines
+
+        // comment 305 of a long run of comments separated by blank lines
+
+        // comment 306 of a long run of comments separated by blank lines
+
+        // comment 307 of a long run of comments separated by blank lines
+
+        // comment 308 of a long run of comments separated by blank lines
+
+        // comment 309 of a long run of comments separated by blank lines
+
+        // comment 310 of a long run of comments separated by blank lines
+
+        // comment 311 of a long run of comments separated by blank lines
+
+        // comment 312 of a long run of comments separated by blank lines
+
+        // comment 313 of a long run of comments separated by blank lines
+
+        // comment 314 of a long run of comments separated by blank lines
+
+        // comment 315 of a long run of comments separated by blank lines
+
+        // comment 316 of a long run of comments separated by blank lines
+
+        // comment 317 of a long run of comments separated by blank lines
+
+        // comment 318 of a long run of comments separated by blank lines
+
+        // comment 319 of a long run of comments separated by blank lines
+
+        // comment 320 of a long run of comments separated by blank lines
+
+        // comment 321 of a long run of comments separated by blank lines
+
+        // comment 322 of a long run of comments separated by blank lines
+
+        // comment 323 of a long run of comments separated by blank lines
+
+        // comment 324 of a long run of comments separated by blank lines
+
+        // comment 325 of a long run of comments separated by blank lines
+
+        // comment 326 of a long run of comments separated by blank lines
+
+        // comment 327 of a long run of comments separated by blank lines
+
+        // comment 328 of a long run of comments separated by blank lines
+
+        // comment 329 of a long run of comments separated by blank lines
+
+        // comment 330 of a long run of comments separated by blank lines
+
+        // comment 331 of a long run of comments separated by blank lines
+
+        // comment 332 of a long run of comments separated by blank lines
+
+        // comment 333 of a long run of comments separated by blank lines
+
+        // comment 334 of a long run of comments separated by blank lines
+
+        // comment 335 of a long run of comments separated by blank lines
+
+        // comment 336 of a long run of comments separated by blank lines
+
+        // comment 337 of a long run of comments separated by blank lines
+
+        // comment 338 of a long run of comments separated by blank lines
+
+        // comment 339 of a long run of comments separated by blank lines
+
+        // comment 340 of a long run of comments separated by blank lines
+
+        // comment 341 of a long run of comments separated by blank lines
+
+        // comment 342 of a long run of comments separated by blank lines
+
+        // comment 343 of a long run of comments separated by blank lines
+
+        // comment 344 of a long run of comments separated by blank lines
+
+        // comment 345 of a long run of comments separated by blank lines
+
+        // comment 346 of a long run of comments separated by blank lines
+
+        // comment 347 of a long run of comments separated by blank lines
+
+        // comment 348 of a long run of comments separated by blank lines
+
+        // comment 349 of a long run of comments separated by blank lines
+
+        // comment 350 of a long run of comments separated by blank lines
+
+        // comment 351 of a long run of comments separated by blank lines
+
+        // comment 352 of a long run of comments separated by blank lines
+
+        // comment 353 of a long run of comments separated by blank lines
+
+        // comment 354 of a long run of comments separated by blank lines
+
+        // comment 355 of a long run of comments separated by blank lines
+
+        // comment 356 of a long run of comments separated by blank lines
+
+        // comment 357 of a long run of comments separated by blank lines
+
+        // comment 358 of a long run of comments separated by blank lines
+
+        // comment 359 of a long run of comments separated by blank lines
+
+        // comment 360 of a long run of comments separated by blank lines
+
+        // comment 361 of a long run of comments separated by blank lines
+
+        // comment 362 of a long run of comments separated by blank lines
+
+        // comment 363 of a long run of comments separated by blank lines
+
+        // comment 364 of a long run of comments separated by blank lines
+
+        // comment 365 of a long run of comments separated by blank lines
+
+        // comment 366 of a long run of comments separated by blank lines
+
+        // comment 367 of a long run of comments separated by blank lines
+
+        // comment 368 of a long run of comments separated by blank lines
+
+        // comment 369 of a long run of comments separated by blank lines
+
+        // comment 370 of a long run of comments separated by blank lines
+
+        // comment 371 of a long run of comments separated by blank lines
+
+        // comment 372 of a long run of comments separated by blank lines
+
+        // comment 373 of a long run of comments separated by blank lines
+
+        // comment 374 of a long run of comments separated by blank lines
+
+        // comment 375 of a long run of comments separated by blank lines
+
+        // comment 376 of a long run of comments separated by blank lines
+
+        // comment 377 of a long run of comments separated by blank lines
+
+        // comment 378 of a long run of comments separated by blank lines
+
+        // comment 379 of a long run of comments separated by blank lines
+
+        // comment 380 of a long run of comments separated by blank lines
+
+        // comment 381 of a long run of comments separated by blank lines
+
+        // comment 382 of a long run of comments separated by blank lines
+
+        // comment 383 of a long run of comments separated by blank lines
+
+        // comment 384 of a long run of comments separated by blank lines
+
+        // comment 385 of a long run of comments separated by blank lines
+
+        // comment 386 of a long run of comments separated by blank lines
+
+        // comment 387 of a long run of comments separated by blank lines
+
+        // comment 388 of a long run of comments separated by blank lines
+
+        // comment 389 of a long run of comments separated by blank lines
+
+        // comment 390 of a long run of comments separated by blank lines
+
+        // comment 391 of a long run of comments separated by blank lines
+
+        // comment 392 of a long run of comments separated by blank lines
+
+        // comment 393 of a long run of comments separated by blank lines
+
+        // comment 394 of a long run of comments separated by blank lines
+
+        // comment 395 of a long run of comments separated by blank lines
+
+        // comment 396 of a long run of comments separated by blank lines
+
+        // comment 397 of a long run of comments separated by blank lines
+
+        // comment 398 of a long run of comments separated by blank lines
+
+        // comment 399 of a long run of comments separated by blank lines
+
+        // comment 400 of a long run of comments separated by blank lines
+
+        // comment 401 of a long run of comments separated by blank lines
+
+        // comment 402 of a long run of comments separated by blank lines
+
+        // comment 403 of a long run of comments separated by blank lines
+
+        // comment 404 of a long run of comments separated by blank lines
+
+        // comment 405 of a long run of comments separated by blank lines
+
+        // comment 406 of a long run of comments separated by blank lines
+
+        // comment 407 of a long run of comments separated by blank lines
+
+        // comment 408 of a long run of comments separated by blank lines
+
+        // comment 409 of a long run of comments separated by blank lines
+
+        // comment 410 of a long run of comments separated by blank lines
+
+        // comment 411 of a long run of comments separated by blank lines
+
+        // comment 412 of a long run of comments separated by blank lines
+
+        // comment 413 of a long run of comments separated by blank lines
+
+        // comment 414 of a long run of comments separated by blank lines
+
+        // comment 415 of a long run of comments separated by blank lines
+
+        // comment 416 of a long run of comments separated by blank lines
+
+        // comment 417 of a long run of comments separated by blank lines
+
+        // comment 418 of a long run of comments separated by blank lines
+
+        // comment 419 of a long run of comments separated by blank lines
+
+        // comment 420 of a long run of comments separated by blank lines
+
+        // comment 421 of a long run of comments separated by blank lines
+
+        // comment 422 of a long run of comments separated by blank lines
+
+        // comment 423 of a long run of comments separated by blank lines
+
+        // comment 424 of a long run of comments separated by blank lines
+
+        // comment 425 of a long run of comments separated by blank lines
+
+        // comment 426 of a long run of comments separated by blank lines
+
+        // comment 427 of a long run of comments separated by blank lines
+
+        // comment 428 of a long run of comments separated by blank lines
+
+        // comment 429 of a long run of comments separated by blank lines
+
+        // comment 430 of a long run of comments separated by blank lines
+
+        // comment 431 of a long run of comments separated by blank lines
+
+        // comment 432 of a long run of comments separated by blank lines
+
+        // comment 433 of a long run of comments separated by blank lines
+
+        // comment 434 of a long run of comments separated by blank lines
+
+        // comment 435 of a long run of comments separated by blank lines
+
+        // comment 436 of a long run of comments separated by blank lines
+
+        // comment 437 of a long run of comments separated by blank lines
+
+        // comment 438 of a long run of comments separated by blank lines
+
+        // comment 439 of a long run of comments separated by blank lines
+
+        // comment 440 of a long run of comments separated by blank lines
+
+        // comment 441 of a long run of comments separated by blank lines
+
+        // comment 442 of a long run of comments separated by blank lines
+
+        // comment 443 of a long run of comments separated by blank lines
+
+        // comment 444 of a long run of comments separated by blank lines
+
+        // comment 445 of a long run of comments separated by blank lines
+
+        // comment 446 of a long run of comments separated by blank lines
+
+        // comment 447 of a long run of comments separated by blank lines
+
+        // comment 448 of a long run of comments separated by blank lines
+
+        // comment 449 of a long run of comments separated by blank lines
+
+        // comment 450 of a long run of comments separated by blank lines
+
+        // comment 451 of a long run of comments separated by blank lines
+
+        // comment 452 of a long run of comments separated by blank lines
+
+        // comment 453 of a long run of comments separated by blank lines
+
+        // comment 454 of a long run of comments separated by blank lines
+
+        // comment 455 of a long run of comments separated by blank lines
+
+        // comment 456 of a long run of comments separated by blank lines
+
+        // comment 457 of a long run of comments separated by blank lines
+
+        // comment 458 of a long run of comments separated by blank lines
+
+        // comment 459 of a long run of comments separated by blank lines
+
+        // comment 460 of a long run of comments separated by blank lines
+
+        // comment 461 of a long run of comments separated by blank lines
+
+        // comment 462 of a long run of comments separated by blank lines
+
+        // comment 463 of a long run of comments separated by blank lines
+
+        // comment 464 of a long run of comments separated by blank lines
+
+        // comment 465 of a long run of comments separated by blank lines
+
+        // comment 466 of a long run of comments separated by blank lines
+
+        // comment 467 of a long run of comments separated by blank lines
+
+        // comment 468 of a long run of comments separated by blank lines
+
+        // comment 469 of a long run of comments separated by blank lines
+
+        // comment 470 of a long run of comments separated by blank lines
+
+        // comment 471 of a long run of comments separated by blank lines
+
+        // comment 472 of a long run of comments separated by blank lines
+
+        // comment 473 of a long run of comments separated by blank lines
+
+        // comment 474 of a long run of comments separated by blank lines
+
+        // comment 475 of a long run of comments separated by blank lines
+
+        // comment 476 of a long run of comments separated by blank lines
+
+        // comment 477 of a long run of comments separated by blank lines
+
+        // comment 478 of a long run of comments separated by blank lines
+
+        // comment 479 of a long run of comments separated by blank lines
+
+        // comment 480 of a long run of comments separated by blank lines
+
+        // comment 481 of a long run of comments separated by blank lines
+
+        // comment 482 of a long run of comments separated by blank lines
+
+        // comment 483 of a long run of comments separated by blank lines
+
+        // comment 484 of a long run of comments separated by blank lines
+
+        // comment 485 of a long run of comments separated by blank lines
+
+        // comment 486 of a long run of comments separated by blank lines
+
+        // comment 487 of a long run of comments separated by blank lines
+
+        // comment 488 of a long run of comments separated by blank lines
+
+        // comment 489 of a long run of comments separated by blank lines
+
+        // comment 490 of a long run of comments separated by blank lines
+
+        // comment 491 of a long run of comments separated by blank lines
+
+        // comment 492 of a long run of comments separated by blank lines
+
+        // comment 493 of a long run of comments separated by blank lines
+
+        // comment 494 of a long run of comments separated by blank lines
+
+        // comment 495 of a long run of comments separated by blank lines
+
+        // comment 496 of a long run of comments separated by blank lines
+
+        // comment 497 of a long run of comments separated by blank lines
+
+        // comment 498 of a long run of comments separated by blank lines
+
+        // comment 499 of a long run of comments separated by blank lines
+
+        // comment 500 of a long run of comments separated by blank lines
+
+        // comment 501 of a long run of comments separated by blank lines
+
+        // comment 502 of a long run of comments separated by blank lines
+
+        // comment 503 of a long run of comments separated by blank lines
+
+        // comment 504 of a long run of comments separated by blank lines
+
+        // comment 505 of a long run of comments separated by blank lines
+
+        // comment 506 of a long run of comments separated by blank lines
+
+        // comment 507 of a long run of comments separated by blank lines
+
+        // comment 508 of a long run of comments separated by blank lines
+
+        // comment 509 of a long run of comments separated by blank lines
+
+        // comment 510 of a long run of comments separated by blank lines
+
+        // comment 511 of a long run of comments separated by blank lines
+
+        // comment 512 of a long run of comments separated by blank lines
+
+        // comment 513 of a long run of comments separated by blank lines
+
+        // comment 514 of a long run of comments separated by blank lines
+
+        // comment 515 of a long run of comments separated by blank lines
+
+        // comment 516 of a long run of comments separated by blank lines
+
+        // comment 517 of a long run of comments separated by blank lines
+
+        // comment 518 of a long run of comments separated by blank lines
+
+        // comment 519 of a long run of comments separated by blank lines
+
+        // comment 520 of a long run of comments separated by blank lines
+
+        // comment 521 of a long run of comments separated by blank lines
+
+        // comment 522 of a long run of comments separated by blank lines
+
+        // comment 523 of a long run of comments separated by blank lines
+
+        // comment 524 of a long run of comments separated by blank lines
+
+        // comment 525 of a long run of comments separated by blank lines
+
+        // comment 526 of a long run of comments separated by blank lines
+
+        // comment 527 of a long run of comments separated by blank lines
+
+        // comment 528 of a long run of comments separated by blank lines
+
+        // comment 529 of a long run of comments separated by blank lines
+
+        // comment 530 of a long run of comments separated by blank lines
+
+        // comment 531 of a long run of comments separated by blank lines
+
+        // comment 532 of a long run of comments separated by blank lines
+
+        // comment 533 of a long run of comments separated by blank lines
+
+        // comment 534 of a long run of comments separated by blank lines
+
+        // comment 535 of a long run of comments separated by blank lines
+
+        // comment 536 of a long run of comments separated by blank lines
+
+        // comment 537 of a long run of comments separated by blank lines
+
+        // comment 538 of a long run of comments separated by blank lines
+
+        // comment 539 of a long run of comments separated by blank lines
+
+        // comment 540 of a long run of comments separated by blank lines
+
+        // comment 541 of a long run of comments separated by blank lines
+
+        // comment 542 of a long run of comments separated by blank lines
+
+        // comment 543 of a long run of comments separated by blank lines
+
+        // comment 544 of a long run of comments separated by blank lines
+
+        // comment 545 of a long run of comments separated by blank lines
+
+        // comment 546 of a long run of comments separated by blank lines
+
+        // comment 547 of a long run of comments separated by blank lines
+
+        // comment 548 of a long run of comments separated by blank lines
+
+        // comment 549 of a long run of comments separated by blank lines
+
+        // comment 550 of a long run of comments separated by blank lines
+
+        // comment 551 of a long run of comments separated by blank lines
+
+        // comment 552 of a long run of comments separated by blank lines
+
+        // comment 553 of a long run of comments separated by blank lines
+
+        // comment 554 of a long run of comments separated by blank lines
+
+        // comment 555 of a long run of comments separated by blank lines
+
+        // comment 556 of a long run of comments separated by blank lines
+
+        // comment 557 of a long run of comments separated by blank lines
+
+        // comment 558 of a long run of comments separated by blank lines
+
+        // comment 559 of a long run of comments separated by blank lines
+
+        // comment 560 of a long run of comments separated by blank lines
+
+        // comment 561 of a long run of comments separated by blank lines
+
+        // comment 562 of a long run of comments separated by blank lines
+
+        // comment 563 of a long run of comments separated by blank lines
+
+        // comment 564 of a long run of comments separated by blank lines
+
+        // comment 565 of a long run of comments separated by blank lines
+
+        // comment 566 of a long run of comments separated by blank lines
+
+        // comment 567 of a long run of comments separated by blank lines
+
+        // comment 568 of a long run of comments separated by blank lines
+
+        // comment 569 of a long run of comments separated by blank lines
+
+        // comment 570 of a long run of comments separated by blank lines
+
+        // comment 571 of a long run of comments separated by blank lines
+
+        // comment 572 of a long run of comments separated by blank lines
+
+        // comment 573 of a long run of comments separated by blank lines
+
+        // comment 574 of a long run of comments separated by blank lines
+
+        // comment 575 of a long run of comments separated by blank lines
+
+        // comment 576 of a long run of comments separated by blank lines
+
+        // comment 577 of a long run of comments separated by blank lines
+
+        // comment 578 of a long run of comments separated by blank lines
+
+        // comment 579 of a long run of comments separated by blank lines
+
+        // comment 580 of a long run of comments separated by blank lines
+
+        // comment 581 of a long run of comments separated by blank lines
+
+        // comment 582 of a long run of comments separated by blank lines
+
+        // comment 583 of a long run of comments separated by blank lines
+
+        // comment 584 of a long run of comments separated by blank lines
+
+        // comment 585 of a long run of comments separated by blank lines
+
+        // comment 586 of a long run of comments separated by blank lines
+
+        // comment 587 of a long run of comments separated by blank lines
+
+        // comment 588 of a long run of comments separated by blank lines
+
+        // comment 589 of a long run of comments separated by blank lines
+
+        // comment 590 of a long run of comments separated by blank lines
+
+        // comment 591 of a long run of comments separated by blank lines
+
+        // comment 592 of a long run of comments separated by blank lines
+
+        // comment 593 of a long run of comments separated by blank lines
+
+        // comment 594 of a long run of comments separated by blank lines
+
+        // comment 595 of a long run of comments separated by blank lines
+
+        // comment 596 of a long run of comments separated by blank lines
+
+        // comment 597 of a long run of comments separated by blank lines
+
+        // comment 598 of a long run of comments separated by blank lines
+
+        // comment 599 of a long run of comments separated by blank lines
+
+        // comment 600 of a long run of comments separated by blank lines
+
+        break;
+    default:
+        value--;
+        /* block comment 1 */
+
+        /* block comment 2 */
+
+        /* block comment 3 */
+
+        /* block comment 4 */
+
+        /* block comment 5 */
+
+        /* block comment 6 */
+
+        /* block comment 7 */
+
+        /* block comment 8 */
+
+        /* block comment 9 */
+
+        /* block comment 10 */
+
+        /* block comment 11 */
+
+        /* block comment 12 */
+
+        /* block comment 13 */
+
+        /* block comment 14 */
+
+        /* block comment 15 */
+
+        /* block comment 16 */
+
+        /* block comment 17 */
+
+        /* block comment 18 */
+
+        /* block comment 19 */
+
+        /* block comment 20 */
+
+        /* block comment 21 */
+
+        /* block comment 22 */
+
+        /* block comment 23 */
+
+        /* block comment 24 */
+
+        /* block comment 25 */
+
+        /* block comment 26 */
+
+        /* block comment 27 */
+
+        /* block comment 28 */
+
+        /* block comment 29 */
+
+        /* block comment 30 */
+
+        /* block comment 31 */
+
+        /* block comment 32 */
+
+        /* block comment 33 */
+
+        /* block comment 34 */
+
+        /* block comment 35 */
+
+        /* block comment 36 */
+
+        /* block comment 37 */
+
+        /* block comment 38 */
+
+        /* block comment 39 */
+
+        /* block comment 40 */
+
+        /* block comment 41 */
+
+        /* block comment 42 */
+
+        /* block comment 43 */
+
+        /* block comment 44 */
+
+        /* block comment 45 */
+
+        /* block comment 46 */
+
+        /* block comment 47 */
+
+        /* block comment 48 */
+
+        /* block comment 49 */
+
+        /* block comment 50 */
+
+        /* block comment 51 */
+
+        /* block comment 52 */
+
+        /* block comment 53 */
+
+        /* block comment 54 */
+
+        /* block comment 55 */
+
+        /* block comment 56 */
+
+        /* block comment 57 */
+
+        /* block comment 58 */
+
+        /* block comment 59 */
+
+        /* block comment 60 */
+
+        /* block comment 61 */
+
+        /* block comment 62 */
+
+        /* block comment 63 */
+
+        /* block comment 64 */
+
+        /* block comment 65 */
+
+        /* block comment 66 */
+
+        /* block comment 67 */
+
+        /* block comment 68 */
+
+        /* block comment 69 */
+
+        /* block comment 70 */
+
+        /* block comment 71 */
+
+        /* block comment 72 */
+
+        /* block comment 73 */
+
+        /* block comment 74 */
+
+        /* block comment 75 */
+
+        /* block comment 76 */
+
+        /* block comment 77 */
+
+        /* block comment 78 */
+
+        /* block comment 79 */
+
+        /* block comment 80 */
+
+        /* block comment 81 */
+
+        /* block comment 82 */
+
+        /* block comment 83 */
+
+        /* block comment 84 */
+
+        /* block comment 85 */
+
+        /* block comment 86 */
+
+        /* block comment 87 */
+
+        /* block comment 88 */
+
+        /* block comment 89 */
+
+        /* block comment 90 */
+
+        /* block comment 91 */
+
+        /* block comment 92 */
+
+        /* block comment 93 */
+
+        /* block comment 94 */
+
+        /* block comment 95 */
+
+        /* block comment 96 */
+
+        /* block comment 97 */
+
+        /* block comment 98 */
+
+        /* block comment 99 */
+
+        /* block comment 100 */
+
+        /* block comment 101 */
+
+        /* block comment 102 */
+
+        /* block comment 103 */
+
+        /* block comment 104 */
+
+        /* block comment 105 */
+
+        /* block comment 106 */
+
+        /* block comment 107 */
+
+        /* block comment 108 */
+
+        /* block comment 109 */
+
+        /* block comment 110 */
+
+        /* block comment 111 */
+
+        /* block comment 112 */
+
+        /* block comment 113 */
+
+        /* block comment 114 */
+
+        /* block comment 115 */
+
+        /* block comment 116 */
+
+        /* block comment 117 */
+
+        /* block comment 118 */
+
+        /* block comment 119 */
+
+        /* block comment 120 */
+
+        /* block comment 121 */
+
+        /* block comment 122 */
+
+        /* block comment 123 */
+
+        /* block comment 124 */
+
+        /* block comment 125 */
+
+        /* block comment 126 */
+
+        /* block comment 127 */
+
+        /* block comment 128 */
+
+        /* block comment 129 */
+
+        /* block comment 130 */
+
+        /* block comment 131 */
+
+        /* block comment 132 */
+
+        /* block comment 133 */
+
+        /* block comment 134 */
+
+        /* block comment 135 */
+
+        /* block comment 136 */
+
+        /* block comment 137 */
+
+        /* block comment 138 */
+
+        /* block comment 139 */
+
+        /* block comment 140 */
+
+        /* block comment 141 */
+
+        /* block comment 142 */
+
+        /* block comment 143 */
+
+        /* block comment 144 */
+
+        /* block comment 145 */
+
+        /* block comment 146 */
+
+        /* block comment 147 */
+
+        /* block comment 148 */
+
+        /* block comment 149 */
+
+        /* block comment 150 */
+
+        /* block comment 151 */
+
+        /* block comment 152 */
+
+        /* block comment 153 */
+
+        /* block comment 154 */
+
+        /* block comment 155 */
+
+        /* block comment 156 */
+
+        /* block comment 157 */
+
+        /* block comment 158 */
+
+        /* block comment 159 */
+
+        /* block comment 160 */
+
+        /* block comment 161 */
+
+        /* block comment 162 */
+
+        /* block comment 163 */
+
+        /* block comment 164 */
+
+        /* block comment 165 */
+
+        /* block comment 166 */
+
+        /* block comment 167 */
+
+        /* block comment 168 */
+
+        /* block comment 169 */
+
+        /* block comment 170 */
+
+        /* block comment 171 */
+
+        /* block comment 172 */
+
+        /* block comment 173 */
+
+        /* block comment 174 */
+
+        /* block comment 175 */
+
+        /* block comment 176 */
+
+        /* block comment 177 */
+
+        /* block comment 178 */
+
+        /* block comment 179 */
+
+        /* block comment 180 */
+
+        /* block comment 181 */
+
+        /* block comment 182 */
+
+        /* block comment 183 */
+
+        /* block comment 184 */
+
+        /* block comment 185 */
+
+        /* block comment 186 */
+
+        /* block comment 187 */
+
+        /* block comment 188 */
+
+        /* block comment 189 */
+
+        /* block comment 190 */
+
+        /* block comment 191 */
+
+        /* block comment 192 */
+
+        /* block comment 193 */
+
+        /* block comment 194 */
+
+        /* block comment 195 */
+
+        /* block comment 196 */
+
+        /* block comment 197 */
+
+        /* block comment 198 */
+
+        /* block comment 199 */
+
+        /* block comment 200 */
+
+        /* block comment 201 */
+
+        /* block comment 202 */
+
+        /* block comment 203 */
+
+        /* block comment 204 */
+
+        /* block comment 205 */
+
+        /* block comment 206 */
+
+        /* block comment 207 */
+
+        /* block comment 208 */
+
+        /* block comment 209 */
+
+        /* block comment 210 */
+
+        /* block comment 211 */
+
+        /* block comment 212 */
+
+        /* block comment 213 */
+
+        /* block comment 214 */
+
+        /* block comment 215 */
+
+        /* block comment 216 */
+
+        /* block comment 217 */
+
+        /* block comment 218 */
+
+        /* block comment 219 */
+
+        /* block comment 220 */
+
+        /* block comment 221 */
+
+        /* block comment 222 */
+
+        /* block comment 223 */
+
+        /* block comment 224 */
+
+        /* block comment 225 */
+
+        /* block comment 226 */
+
+        /* block comment 227 */
+
+        /* block comment 228 */
+
+        /* block comment 229 */
+
+        /* block comment 230 */
+
+        /* block comment 231 */
+
+        /* block comment 232 */
+
+        /* block comment 233 */
+
+        /* block comment 234 */
+
+        /* block comment 235 */
+
+        /* block comment 236 */
+
+        /* block comment 237 */
+
+        /* block comment 238 */
+
+        /* block comment 239 */
+
+        /* block comment 240 */
+
+        /* block comment 241 */
+
+        /* block comment 242 */
+
+        /* block comment 243 */
+
+        /* block comment 244 */
+
+        /* block comment 245 */
+
+        /* block comment 246 */
+
+        /* block comment 247 */
+
+        /* block comment 248 */
+
+        /* block comment 249 */
+
+        /* block comment 250 */
+
+        /* block comment 251 */
+
+        /* block comment 252 */
+
+        /* block comment 253 */
+
+        /* block comment 254 */
+
+        /* block comment 255 */
+
+        /* block comment 256 */
+
+        /* block comment 257 */
+
+        /* block comment 258 */
+
+        /* block comment 259 */
+
+        /* block comment 260 */
+
+        /* block comment 261 */
+
+        /* block comment 262 */
+
+        /* block comment 263 */
+
+        /* block comment 264 */
+
+        /* block comment 265 */
+
+        /* block comment 266 */
+
+        /* block comment 267 */
+
+        /* block comment 268 */
+
+        /* block comment 269 */
+
+        /* block comment 270 */
+
+        /* block comment 271 */
+
+        /* block comment 272 */
+
+        /* block comment 273 */
+
+        /* block comment 274 */
+
+        /* block comment 275 */
+
+        /* block comment 276 */
+
+        /* block comment 277 */
+
+        /* block comment 278 */
+
+        /* block comment 279 */
+
+        /* block comment 280 */
+
+        /* block comment 281 */
+
+        /* block comment 282 */
+
+        /* block comment 283 */
+
+        /* block comment 284 */
+
+        /* block comment 285 */
+
+        /* block comment 286 */
+
+        /* block comment 287 */
+
+        /* block comment 288 */
+
+        /* block comment 289 */
+
+        /* block comment 290 */
+
+        /* block comment 291 */
+
+        /* block comment 292 */
+
+        /* block comment 293 */
+
+        /* block comment 294 */
+
+        /* block comment 295 */
+
+        /* block comment 296 */
+
+        /* block comment 297 */
+
+        /* block comment 298 */
+
+        /* block comment 299 */
+
+        /* block comment 300 */
+
+        /* block comment 301 */
+
+        /* block comment 302 */
+
+        /* block comment 303 */
+
+        /* block comment 304 */
+
+        /* block comment 305 */
+
+        /* block comment 306 */
+
+        /* block comment 307 */
+
+        /* block comment 308 */
+
+        /* block comment 309 */
+
+        /* block comment 310 */
+
+        /* block comment 311 */
+
+        /* block comment 312 */
+
+        /* block comment 313 */
+
+        /* block comment 314 */
+
+        /* block comment 315 */
+
+        /* block comment 316 */
+
+        /* block comment 317 */
+
+        /* block comment 318 */
+
+        /* block comment 319 */
+
+        /* block comment 320 */
+
+        /* block comment 321 */
+
+        /* block comment 322 */
+
+        /* block comment 323 */
+
+        /* block comment 324 */
+
+        /* block comment 325 */
+
+        /* block comment 326 */
+
+        /* block comment 327 */
+
+        /* block comment 328 */
+
+        /* block comment 329 */
+
+        /* block comment 330 */
+
+        /* block comment 331 */
+
+        /* block comment 332 */
+
+        /* block comment 333 */
+
+        /* block comment 334 */
+
+        /* block comment 335 */
+
+        /* block comment 336 */
+
+        /* block comment 337 */
+
+        /* block comment 338 */
+
+        /* block comment 339 */
+
+        /* block comment 340 */
+
+        /* block comment 341 */
+
+        /* block comment 342 */
+
+        /* block comment 343 */
+
+        /* block comment 344 */
+
+        /* block comment 345 */
+
+        /* block comment 346 */
+
+        /* block comment 347 */
+
+        /* block comment 348 */
+
+        /* block comment 349 */
+
+        /* block comment 350 */
+
+        /* block comment 351 */
+
+        /* block comment 352 */
+
+        /* block comment 353 */
+
+        /* block comment 354 */
+
+        /* block comment 355 */
+
+        /* block comment 356 */
+
+        /* block comment 357 */
+
+        /* block comment 358 */
+
+        /* block comment 359 */
+
+        /* block comment 360 */
+
+        /* block comment 361 */
+
+        /* block comment 362 */
+
+        /* block comment 363 */
+
+        /* block comment 364 */
+
+        /* block comment 365 */
+
+        /* block comment 366 */
+
+        /* block comment 367 */
+
+        /* block comment 368 */
+
+        /* block comment 369 */
+
+        /* block comment 370 */
+
+        /* block comment 371 */
+
+        /* block comment 372 */
+
+        /* block comment 373 */
+
+        /* block comment 374 */
+
+        /* block comment 375 */
+
+        /* block comment 376 */
+
+        /* block comment 377 */
+
+        /* block comment 378 */
+
+        /* block comment 379 */
+
+        /* block comment 380 */
+
+        /* block comment 381 */
+
+        /* block comment 382 */
+
+        /* block comment 383 */
+
+        /* block comment 384 */
+
+        /* block comment 385 */
+
+        /* block comment 386 */
+
+        /* block comment 387 */
+
+        /* block comment 388 */
+
+        /* block comment 389 */
+
+        /* block comment 390 */
+
+        /* block comment 391 */
+
+        /* block comment 392 */
+
+        /* block comment 393 */
+
+        /* block comment 394 */
+
+        /* block comment 395 */
+
+        /* block comment 396 */
+
+        /* block comment 397 */
+
+        /* block comment 398 */
+
+        /* block comment 399 */
+
+        /* block comment 400 */
+
+        /* block comment 401 */
+
+        /* block comment 402 */
+
+        /* block comment 403 */
+
+        /* block comment 404 */
+
+        /* block comment 405 */
+
+        /* block comment 406 */
+
+        /* block comment 407 */
+
+        /* block comment 408 */
+
+        /* block comment 409 */
+
+        /* block comment 410 */
+
+        /* block comment 411 */
+
+        /* block comment 412 */
+
+        /* block comment 413 */
+
+        /* block comment 414 */
+
+        /* block comment 415 */
+
+        /* block comment 416 */
+
+        /* block comment 417 */
+
+        /* block comment 418 */
+
+        /* block comment 419 */
+
+        /* block comment 420 */
+
+        /* block comment 421 */
+
+        /* block comment 422 */
+
+        /* block comment 423 */
+
+        /* block comment 424 */
+
+        /* block comment 425 */
+
+        /* block comment 426 */
+
+        /* block comment 427 */
+
+        /* block comment 428 */
+
+        /* block comment 429 */
+
+        /* block comment 430 */
+
+        /* block comment 431 */
+
+        /* block comment 432 */
+
+        /* block comment 433 */
+
+        /* block comment 434 */
+
+        /* block comment 435 */
+
+        /* block comment 436 */
+
+        /* block comment 437 */
+
+        /* block comment 438 */
+
+        /* block comment 439 */
+
+        /* block comment 440 */
+
+        /* block comment 441 */
+
+        /* block comment 442 */
+
+        /* block comment 443 */
+
+        /* block comment 444 */
+
+        /* block comment 445 */
+
+        /* block comment 446 */
+
+        /* block comment 447 */
+
+        /* block comment 448 */
+
+        /* block comment 449 */
+
+        /* block comment 450 */
+
+        /* block comment 451 */
+
+        /* block comment 452 */
+
+        /* block comment 453 */
+
+        /* block comment 454 */
+
+        /* block comment 455 */
+
+        /* block comment 456 */
+
+        /* block comment 457 */
+
+        /* block comment 458 */
+
+        /* block comment 459 */
+
+        /* block comment 460 */
+
+        /* block comment 461 */
+
+        /* block comment 462 */
+
+        /* block comment 463 */
+
+        /* block comment 464 */
+
+        /* block comment 465 */
+
+        /* block comment 466 */
+
+        /* block comment 467 */
+
+        /* block comment 468 */
+
+        /* block comment 469 */
+
+        /* block comment 470 */
+
+        /* block comment 471 */
+
+        /* block comment 472 */
+
+        /* block comment 473 */
+
+        /* block comment 474 */
+
+        /* block comment 475 */
+
+        /* block comment 476 */
+
+        /* block comment 477 */
+
+        /* block comment 478 */
+
+        /* block comment 479 */
+
+        /* block comment 480 */
+
+        /* block comment 481 */
+
+        /* block comment 482 */
+
+        /* block comment 483 */
+
+        /* block comment 484 */
+
+        /* block comment 485 */
+
+        /* block comment 486 */
+
+        /* block comment 487 */
+
+        /* block comment 488 */
+
+        /* block comment 489 */
+
+        /* block comment 490 */
+
+        /* block comment 491 */
+
+        /* block comment 492 */
+
+        /* block comment 493 */
+
+        /* block comment 494 */
+
+        /* block comment 495 */
+
+        /* block comment 496 */
+
+        /* block comment 497 */
+
+        /* block comment 498 */
+
+        /* block comment 499 */
+
+        /* block comment 500 */
+
+        /* block comment 501 */
+
+        /* block comment 502 */
+
+        /* block comment 503 */
+
+        /* block comment 504 */
+
+        /* block comment 505 */
+
+        /* block comment 506 */
+
+        /* block comment 507 */
+
+        /* block comment 508 */
+
+        /* block comment 509 */
+
+        /* block comment 510 */
+
+        /* block comment 511 */
+
+        /* block comment 512 */
+
+        /* block comment 513 */
+
+        /* block comment 514 */
+
+        /* block comment 515 */
+
+        /* block comment 516 */
+
+        /* block comment 517 */
+
+        /* block comment 518 */
+
+        /* block comment 519 */
+
+        /* block comment 520 */
+
+        /* block comment 521 */
+
+        /* block comment 522 */
+
+        /* block comment 523 */
+
+        /* block comment 524 */
+
+        /* block comment 525 */
+
+        /* block comment 526 */
+
+        /* block comment 527 */
+
+        /* block comment 528 */
+
+        /* block comment 529 */
+
+        /* block comment 530 */
+
+        /* block comment 531 */
+
+        /* block comment 532 */
+
+        /* block comment 533 */
+
+        /* block comment 534 */
+
+        /* block comment 535 */
+
+        /* block comment 536 */
+
+        /* block comment 537 */
+
+        /* block comment 538 */
+
+        /* block comment 539 */
+
+        /* block comment 540 */
+
+        /* block comment 541 */
+
+        /* block comment 542 */
+
+        /* block comment 543 */
+
+        /* block comment 544 */
+
+        /* block comment 545 */
+
+        /* block comment 546 */
+
+        /* block comment 547 */
+
+        /* block comment 548 */
+
+        /* block comment 549 */
+
+        /* block comment 550 */
+
+        /* block comment 551 */
+
+        /* block comment 552 */
+
+        /* block comment 553 */
+
+        /* block comment 554 */
+
+        /* block comment 555 */
+
+        /* block comment 556 */
+
+        /* block comment 557 */
+
+        /* block comment 558 */
+
+        /* block comment 559 */
+
+        /* block comment 560 */
+
+        /* block comment 561 */
+
+        /* block comment 562 */
+
+        /* block comment 563 */
+
+        /* block comment 564 */
+
+        /* block comment 565 */
+
+        /* block comment 566 */
+
+        /* block comment 567 */
+
+        /* block comment 568 */
+
+        /* block comment 569 */
+
+        /* block comment 570 */
+
+        /* block comment 571 */
+
+        /* block comment 572 */
+
+        /* block comment 573 */
+
+        /* block comment 574 */
+
+        /* block comment 575 */
+
+        /* block comment 576 */
+
+        /* block comment 577 */
+
+        /* block comment 578 */
+
+        /* block comment 579 */
+
+        /* block comment 580 */
+
+        /* block comment 581 */
+
+        /* block comment 582 */
+
+        /* block comment 583 */
+
+        /* block comment 584 */
+
+        /* block comment 585 */
+
+        /* block comment 586 */
+
+        /* block comment 587 */
+
+        /* block comment 588 */
+
+        /* block comment 589 */
+
+        /* block comment 590 */
+
+        /* block comment 591 */
+
+        /* block comment 592 */
+
+        /* block comment 593 */
+
+        /* block comment 594 */
+
+        /* block comment 595 */
+
+        /* block comment 596 */
+
+        /* block comment 597 */
+
+        /* block comment 598 */
+
+        /* block comment 599 */
+
+        /* block comment 600 */
+
+        break;
+    }
+    return value;
+}
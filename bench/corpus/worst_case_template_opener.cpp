@@ -0,0 +1,1507 @@
+// Worst case for the look ahead of checkIfTemplateOpener().
+// Each '<' is searched to the end of the argument list to find it is not a template.
+// Without the saved results the search is repeated for each comparison.
+
+bool checkLimits(const int* a, const int* b)
+{
+    return allOf(a[0] < b[0],
+                 a[1] < b[1],
+                 a[2] < b[2],
+                 a[3] < b[3],
+                 a[4] < b[4],
+                 a[5] < b[5],
+                 a[6] < b[6],
+                 a[7] < b[7],
+                 a[8] < b[8],
+                 a[9] < b[9],
+                 a[10] < b[10],
+                 a[11] < b[11],
+                 a[12] < b[12],
+                 a[13] < b[13],
+                 a[14] < b[14],
+                 a[15] < b[15],
+                 a[16] < b[16],
+                 a[17] < b[17],
+                 a[18] < b[18],
+                 a[19] < b[19],
+                 a[20] < b[20],
+                 a[21] < b[21],
+                 a[22] < b[22],
+                 a[23] < b[23],
+                 a[24] < b[24],
+                 a[25] < b[25],
+                 a[26] < b[26],
+                 a[27] < b[27],
+                 a[28] < b[28],
+                 a[29] < b[29],
+                 a[30] < b[30],
+                 a[31] < b[31],
+                 a[32] < b[32],
+                 a[33] < b[33],
+                 a[34] < b[34],
+                 a[35] < b[35],
+                 a[36] < b[36],
+                 a[37] < b[37],
+                 a[38] < b[38],
+                 a[39] < b[39],
+                 a[40] < b[40],
+                 a[41] < b[41],
+                 a[42] < b[42],
+                 a[43] < b[43],
+                 a[44] < b[44],
+                 a[45] < b[45],
+                 a[46] < b[46],
+                 a[47] < b[47],
+                 a[48] < b[48],
+                 a[49] < b[49],
+                 a[50] < b[50],
+                 a[51] < b[51],
+                 a[52] < b[52],
+                 a[53] < b[53],
+                 a[54] < b[54],
+                 a[55] < b[55],
+                 a[56] < b[56],
+                 a[57] < b[57],
+                 a[58] < b[58],
+                 a[59] < b[59],
+                 a[60] < b[60],
+                 a[61] < b[61],
+                 a[62] < b[62],
+                 a[63] < b[63],
+                 a[64] < b[64],
+                 a[65] < b[65],
+                 a[66] < b[66],
+                 a[67] < b[67],
+                 a[68] < b[68],
+                 a[69] < b[69],
+                 a[70] < b[70],
+                 a[71] < b[71],
+                 a[72] < b[72],
+                 a[73] < b[73],
+                 a[74] < b[74],
+                 a[75] < b[75],
+                 a[76] < b[76],
+                 a[77] < b[77],
+                 a[78] < b[78],
+                 a[79] < b[79],
+                 a[80] < b[80],
+                 a[81] < b[81],
+                 a[82] < b[82],
+                 a[83] < b[83],
+                 a[84] < b[84],
+                 a[85] < b[85],
+                 a[86] < b[86],
+                 a[87] < b[87],
+                 a[88] < b[88],
+                 a[89] < b[89],
+                 a[90] < b[90],
+                 a[91] < b[91],
+                 a[92] < b[92],
+                 a[93] < b[93],
+                 a[94] < b[94],
+                 a[95] < b[95],
+                 a[96] < b[96],
+                 a[97] < b[97],
+                 a[98] < b[98],
+                 a[99] < b[99],
+                 a[100] < b[100],
+                 a[101] < b[101],
+                 a[102] < b[102],
+                 a[103] < b[103],
+                 a[104] < b[104],
+                 a[105] < b[105],
+                 a[106] < b[106],
+                 a[107] < b[107],
+                 a[108] < b[108],
+                 a[109] < b[109],
+                 a[110] < b[110],
+                 a[111] < b[111],
+                 a[112] < b[112],
+                 a[113] < b[113],
+                 a[114] < b[114],
+                 a[115] < b[115],
+                 a[116] < b[116],
+                 a[117] < b[117],
+                 a[118] < b[118],
+                 a[119] < b[119],
+                 a[120] < b[120],
+                 a[121] < b[121],
+                 a[122] < b[122],
+                 a[123] < b[123],
+                 a[124] < b[124],
+                 a[125] < b[125],
+                 a[126] < b[126],
+                 a[127] < b[127],
+                 a[128] < b[128],
+                 a[129] < b[129],
+                 a[130] < b[130],
+                 a[131] < b[131],
+                 a[132] < b[132],
+                 a[133] < b[133],
+                 a[134] < b[134],
+                 a[135] < b[135],
+                 a[136] < b[136],
+                 a[137] < b[137],
+                 a[138] < b[138],
+                 a[139] < b[139],
+                 a[140] < b[140],
+                 a[141] < b[141],
+                 a[142] < b[142],
+                 a[143] < b[143],
+                 a[144] < b[144],
+                 a[145] < b[145],
+                 a[146] < b[146],
+                 a[147] < b[147],
+                 a[148] < b[148],
+                 a[149] < b[149],
+                 a[150] < b[150],
+                 a[151] < b[151],
+                 a[152] < b[152],
+                 a[153] < b[153],
+                 a[154] < b[154],
+                 a[155] < b[155],
+                 a[156] < b[156],
+                 a[157] < b[157],
+                 a[158] < b[158],
+                 a[159] < b[159],
+                 a[160] < b[160],
+                 a[161] < b[161],
+                 a[162] < b[162],
+                 a[163] < b[163],
+                 a[164] < b[164],
+                 a[165] < b[165],
+                 a[166] < b[166],
+                 a[167] < b[167],
+                 a[168] < b[168],
+                 a[169] < b[169],
+                 a[170] < b[170],
+                 a[171] < b[171],
+                 a[172] < b[172],
+                 a[173] < b[173],
+                 a[174] < b[174],
+                 a[175] < b[175],
+                 a[176] < b[176],
+                 a[177] < b[177],
+                 a[178] < b[178],
+                 a[179] < b[179],
+                 a[180] < b[180],
+                 a[181] < b[181],
+                 a[182] < b[182],
+                 a[183] < b[183],
+                 a[184] < b[184],
+                 a[185] < b[185],
+                 a[186] < b[186],
+                 a[187] < b[187],
+                 a[188] < b[188],
+                 a[189] < b[189],
+                 a[190] < b[190],
+                 a[191] < b[191],
+                 a[192] < b[192],
+                 a[193] < b[193],
+                 a[194] < b[194],
+                 a[195] < b[195],
+                 a[196] < b[196],
+                 a[197] < b[197],
+                 a[198] < b[198],
+                 a[199] < b[199],
+                 a[200] < b[200],
+                 a[201] < b[201],
+                 a[202] < b[202],
+                 a[203] < b[203],
+                 a[204] < b[204],
+                 a[205] < b[205],
+                 a[206] < b[206],
+                 a[207] < b[207],
+                 a[208] < b[208],
+                 a[209] < b[209],
+                 a[210] < b[210],
+                 a[211] < b[211],
+                 a[212] < b[212],
+                 a[213] < b[213],
+                 a[214] < b[214],
+                 a[215] < b[215],
+                 a[216] < b[216],
+                 a[217] < b[217],
+                 a[218] < b[218],
+                 a[219] < b[219],
+                 a[220] < b[220],
+                 a[221] < b[221],
+                 a[222] < b[222],
+                 a[223] < b[223],
+                 a[224] < b[224],
+                 a[225] < b[225],
+                 a[226] < b[226],
+                 a[227] < b[227],
+                 a[228] < b[228],
+                 a[229] < b[229],
+                 a[230] < b[230],
+                 a[231] < b[231],
+                 a[232] < b[232],
+                 a[233] < b[233],
+                 a[234] < b[234],
+                 a[235] < b[235],
+                 a[236] < b[236],
+                 a[237] < b[237],
+                 a[238] < b[238],
+                 a[239] < b[239],
+                 a[240] < b[240],
+                 a[241] < b[241],
+                 a[242] < b[242],
+                 a[243] < b[243],
+                 a[244] < b[244],
+                 a[245] < b[245],
+                 a[246] < b[246],
+                 a[247] < b[247],
+                 a[248] < b[248],
+                 a[249] < b[249],
+                 a[250] < b[250],
+                 a[251] < b[251],
+                 a[252] < b[252],
+                 a[253] < b[253],
+                 a[254] < b[254],
+                 a[255] < b[255],
+                 a[256] < b[256],
+                 a[257] < b[257],
+                 a[258] < b[258],
+                 a[259] < b[259],
+                 a[260] < b[260],
+                 a[261] < b[261],
+                 a[262] < b[262],
+                 a[263] < b[263],
+                 a[264] < b[264],
+                 a[265] < b[265],
+                 a[266] < b[266],
+                 a[267] < b[267],
+                 a[268] < b[268],
+                 a[269] < b[269],
+                 a[270] < b[270],
+                 a[271] < b[271],
+                 a[272] < b[272],
+                 a[273] < b[273],
+                 a[274] < b[274],
+                 a[275] < b[275],
+                 a[276] < b[276],
+                 a[277] < b[277],
+                 a[278] < b[278],
+                 a[279] < b[279],
+                 a[280] < b[280],
+                 a[281] < b[281],
+                 a[282] < b[282],
+                 a[283] < b[283],
+                 a[284] < b[284],
+                 a[285] < b[285],
+                 a[286] < b[286],
+                 a[287] < b[287],
+                 a[288] < b[288],
+                 a[289] < b[289],
+                 a[290] < b[290],
+                 a[291] < b[291],
+                 a[292] < b[292],
+                 a[293] < b[293],
+                 a[294] < b[294],
+                 a[295] < b[295],
+                 a[296] < b[296],
+                 a[297] < b[297],
+                 a[298] < b[298],
+                 a[299] < b[299],
+                 a[300] < b[300],
+                 a[301] < b[301],
+                 a[302] < b[302],
+                 a[303] < b[303],
+                 a[304] < b[304],
+                 a[305] < b[305],
+                 a[306] < b[306],
+                 a[307] < b[307],
+                 a[308] < b[308],
+                 a[309] < b[309],
+                 a[310] < b[310],
+                 a[311] < b[311],
+                 a[312] < b[312],
+                 a[313] < b[313],
+                 a[314] < b[314],
+                 a[315] < b[315],
+                 a[316] < b[316],
+                 a[317] < b[317],
+                 a[318] < b[318],
+                 a[319] < b[319],
+                 a[320] < b[320],
+                 a[321] < b[321],
+                 a[322] < b[322],
+                 a[323] < b[323],
+                 a[324] < b[324],
+                 a[325] < b[325],
+                 a[326] < b[326],
+                 a[327] < b[327],
+                 a[328] < b[328],
+                 a[329] < b[329],
+                 a[330] < b[330],
+                 a[331] < b[331],
+                 a[332] < b[332],
+                 a[333] < b[333],
+                 a[334] < b[334],
+                 a[335] < b[335],
+                 a[336] < b[336],
+                 a[337] < b[337],
+                 a[338] < b[338],
+                 a[339] < b[339],
+                 a[340] < b[340],
+                 a[341] < b[341],
+                 a[342] < b[342],
+                 a[343] < b[343],
+                 a[344] < b[344],
+                 a[345] < b[345],
+                 a[346] < b[346],
+                 a[347] < b[347],
+                 a[348] < b[348],
+                 a[349] < b[349],
+                 a[350] < b[350],
+                 a[351] < b[351],
+                 a[352] < b[352],
+                 a[353] < b[353],
+                 a[354] < b[354],
+                 a[355] < b[355],
+                 a[356] < b[356],
+                 a[357] < b[357],
+                 a[358] < b[358],
+                 a[359] < b[359],
+                 a[360] < b[360],
+                 a[361] < b[361],
+                 a[362] < b[362],
+                 a[363] < b[363],
+                 a[364] < b[364],
+                 a[365] < b[365],
+                 a[366] < b[366],
+                 a[367] < b[367],
+                 a[368] < b[368],
+                 a[369] < b[369],
+                 a[370] < b[370],
+                 a[371] < b[371],
+                 a[372] < b[372],
+                 a[373] < b[373],
+                 a[374] < b[374],
+                 a[375] < b[375],
+                 a[376] < b[376],
+                 a[377] < b[377],
+                 a[378] < b[378],
+                 a[379] < b[379],
+                 a[380] < b[380],
+                 a[381] < b[381],
+                 a[382] < b[382],
+                 a[383] < b[383],
+                 a[384] < b[384],
+                 a[385] < b[385],
+                 a[386] < b[386],
+                 a[387] < b[387],
+                 a[388] < b[388],
+                 a[389] < b[389],
+                 a[390] < b[390],
+                 a[391] < b[391],
+                 a[392] < b[392],
+                 a[393] < b[393],
+                 a[394] < b[394],
+                 a[395] < b[395],
+                 a[396] < b[396],
+                 a[397] < b[397],
+                 a[398] < b[398],
+                 a[399] < b[399],
+                 a[400] < b[400],
+                 a[401] < b[401],
+                 a[402] < b[402],
+                 a[403] < b[403],
+                 a[404] < b[404],
+                 a[405] < b[405],
+                 a[406] < b[406],
+                 a[407] < b[407],
+                 a[408] < b[408],
+                 a[409] < b[409],
+                 a[410] < b[410],
+                 a[411] < b[411],
+                 a[412] < b[412],
+                 a[413] < b[413],
+                 a[414] < b[414],
+                 a[415] < b[415],
+                 a[416] < b[416],
+                 a[417] < b[417],
+                 a[418] < b[418],
+                 a[419] < b[419],
+                 a[420] < b[420],
+                 a[421] < b[421],
+                 a[422] < b[422],
+                 a[423] < b[423],
+                 a[424] < b[424],
+                 a[425] < b[425],
+                 a[426] < b[426],
+                 a[427] < b[427],
+                 a[428] < b[428],
+                 a[429] < b[429],
+                 a[430] < b[430],
+                 a[431] < b[431],
+                 a[432] < b[432],
+                 a[433] < b[433],
+                 a[434] < b[434],
+                 a[435] < b[435],
+                 a[436] < b[436],
+                 a[437] < b[437],
+                 a[438] < b[438],
+                 a[439] < b[439],
+                 a[440] < b[440],
+                 a[441] < b[441],
+                 a[442] < b[442],
+                 a[443] < b[443],
+                 a[444] < b[444],
+                 a[445] < b[445],
+                 a[446] < b[446],
+                 a[447] < b[447],
+                 a[448] < b[448],
+                 a[449] < b[449],
+                 a[450] < b[450],
+                 a[451] < b[451],
+                 a[452] < b[452],
+                 a[453] < b[453],
+                 a[454] < b[454],
+                 a[455] < b[455],
+                 a[456] < b[456],
+                 a[457] < b[457],
+                 a[458] < b[458],
+                 a[459] < b[459],
+                 a[460] < b[460],
+                 a[461] < b[461],
+                 a[462] < b[462],
+                 a[463] < b[463],
+                 a[464] < b[464],
+                 a[465] < b[465],
+                 a[466] < b[466],
+                 a[467] < b[467],
+                 a[468] < b[468],
+                 a[469] < b[469],
+                 a[470] < b[470],
+                 a[471] < b[471],
+                 a[472] < b[472],
+                 a[473] < b[473],
+                 a[474] < b[474],
+                 a[475] < b[475],
+                 a[476] < b[476],
+                 a[477] < b[477],
+                 a[478] < b[478],
+                 a[479] < b[479],
+                 a[480] < b[480],
+                 a[481] < b[481],
+                 a[482] < b[482],
+                 a[483] < b[483],
+                 a[484] < b[484],
+                 a[485] < b[485],
+                 a[486] < b[486],
+                 a[487] < b[487],
+                 a[488] < b[488],
+                 a[489] < b[489],
+                 a[490] < b[490],
+                 a[491] < b[491],
+                 a[492] < b[492],
+                 a[493] < b[493],
+                 a[494] < b[494],
+                 a[495] < b[495],
+                 a[496] < b[496],
+                 a[497] < b[497],
+                 a[498] < b[498],
+                 a[499] < b[499],
+                 a[500] < b[500],
+                 a[501] < b[501],
+                 a[502] < b[502],
+                 a[503] < b[503],
+                 a[504] < b[504],
+                 a[505] < b[505],
+                 a[506] < b[506],
+                 a[507] < b[507],
+                 a[508] < b[508],
+                 a[509] < b[509],
+                 a[510] < b[510],
+                 a[511] < b[511],
+                 a[512] < b[512],
+                 a[513] < b[513],
+                 a[514] < b[514],
+                 a[515] < b[515],
+                 a[516] < b[516],
+                 a[517] < b[517],
+                 a[518] < b[518],
+                 a[519] < b[519],
+                 a[520] < b[520],
+                 a[521] < b[521],
+                 a[522] < b[522],
+                 a[523] < b[523],
+                 a[524] < b[524],
+                 a[525] < b[525],
+                 a[526] < b[526],
+                 a[527] < b[527],
+                 a[528] < b[528],
+                 a[529] < b[529],
+                 a[530] < b[530],
+                 a[531] < b[531],
+                 a[532] < b[532],
+                 a[533] < b[533],
+                 a[534] < b[534],
+                 a[535] < b[535],
+                 a[536] < b[536],
+                 a[537] < b[537],
+                 a[538] < b[538],
+                 a[539] < b[539],
+                 a[540] < b[540],
+                 a[541] < b[541],
+                 a[542] < b[542],
+                 a[543] < b[543],
+                 a[544] < b[544],
+                 a[545] < b[545],
+                 a[546] < b[546],
+                 a[547] < b[547],
+                 a[548] < b[548],
+                 a[549] < b[549],
+                 a[550] < b[550],
+                 a[551] < b[551],
+                 a[552] < b[552],
+                 a[553] < b[553],
+                 a[554] < b[554],
+                 a[555] < b[555],
+                 a[556] < b[556],
+                 a[557] < b[557],
+                 a[558] < b[558],
+                 a[559] < b[559],
+                 a[560] < b[560],
+                 a[561] < b[561],
+                 a[562] < b[562],
+                 a[563] < b[563],
+                 a[564] < b[564],
+                 a[565] < b[565],
+                 a[566] < b[566],
+                 a[567] < b[567],
+                 a[568] < b[568],
+                 a[569] < b[569],
+                 a[570] < b[570],
+                 a[571] < b[571],
+                 a[572] < b[572],
+                 a[573] < b[573],
+                 a[574] < b[574],
+                 a[575] < b[575],
+                 a[576] < b[576],
+                 a[577] < b[577],
+                 a[578] < b[578],
+                 a[579] < b[579],
+                 a[580] < b[580],
+                 a[581] < b[581],
+                 a[582] < b[582],
+                 a[583] < b[583],
+                 a[584] < b[584],
+                 a[585] < b[585],
+                 a[586] < b[586],
+                 a[587] < b[587],
+                 a[588] < b[588],
+                 a[589] < b[589],
+                 a[590] < b[590],
+                 a[591] < b[591],
+                 a[592] < b[592],
+                 a[593] < b[593],
+                 a[594] < b[594],
+                 a[595] < b[595],
+                 a[596] < b[596],
+                 a[597] < b[597],
+                 a[598] < b[598],
+                 a[599] < b[599],
+                 a[600] < b[600],
+                 a[601] < b[601],
+                 a[602] < b[602],
+                 a[603] < b[603],
+                 a[604] < b[604],
+                 a[605] < b[605],
+                 a[606] < b[606],
+                 a[607] < b[607],
+                 a[608] < b[608],
+                 a[609] < b[609],
+                 a[610] < b[610],
+                 a[611] < b[611],
+                 a[612] < b[612],
+                 a[613] < b[613],
+                 a[614] < b[614],
+                 a[615] < b[615],
+                 a[616] < b[616],
+                 a[617] < b[617],
+                 a[618] < b[618],
+                 a[619] < b[619],
+                 a[620] < b[620],
+                 a[621] < b[621],
+                 a[622] < b[622],
+                 a[623] < b[623],
+                 a[624] < b[624],
+                 a[625] < b[625],
+                 a[626] < b[626],
+                 a[627] < b[627],
+                 a[628] < b[628],
+                 a[629] < b[629],
+                 a[630] < b[630],
+                 a[631] < b[631],
+                 a[632] < b[632],
+                 a[633] < b[633],
+                 a[634] < b[634],
+                 a[635] < b[635],
+                 a[636] < b[636],
+                 a[637] < b[637],
+                 a[638] < b[638],
+                 a[639] < b[639],
+                 a[640] < b[640],
+                 a[641] < b[641],
+                 a[642] < b[642],
+                 a[643] < b[643],
+                 a[644] < b[644],
+                 a[645] < b[645],
+                 a[646] < b[646],
+                 a[647] < b[647],
+                 a[648] < b[648],
+                 a[649] < b[649],
+                 a[650] < b[650],
+                 a[651] < b[651],
+                 a[652] < b[652],
+                 a[653] < b[653],
+                 a[654] < b[654],
+                 a[655] < b[655],
+                 a[656] < b[656],
+                 a[657] < b[657],
+                 a[658] < b[658],
+                 a[659] < b[659],
+                 a[660] < b[660],
+                 a[661] < b[661],
+                 a[662] < b[662],
+                 a[663] < b[663],
+                 a[664] < b[664],
+                 a[665] < b[665],
+                 a[666] < b[666],
+                 a[667] < b[667],
+                 a[668] < b[668],
+                 a[669] < b[669],
+                 a[670] < b[670],
+                 a[671] < b[671],
+                 a[672] < b[672],
+                 a[673] < b[673],
+                 a[674] < b[674],
+                 a[675] < b[675],
+                 a[676] < b[676],
+                 a[677] < b[677],
+                 a[678] < b[678],
+                 a[679] < b[679],
+                 a[680] < b[680],
+                 a[681] < b[681],
+                 a[682] < b[682],
+                 a[683] < b[683],
+                 a[684] < b[684],
+                 a[685] < b[685],
+                 a[686] < b[686],
+                 a[687] < b[687],
+                 a[688] < b[688],
+                 a[689] < b[689],
+                 a[690] < b[690],
+                 a[691] < b[691],
+                 a[692] < b[692],
+                 a[693] < b[693],
+                 a[694] < b[694],
+                 a[695] < b[695],
+                 a[696] < b[696],
+                 a[697] < b[697],
+                 a[698] < b[698],
+                 a[699] < b[699],
+                 a[700] < b[700],
+                 a[701] < b[701],
+                 a[702] < b[702],
+                 a[703] < b[703],
+                 a[704] < b[704],
+                 a[705] < b[705],
+                 a[706] < b[706],
+                 a[707] < b[707],
+                 a[708] < b[708],
+                 a[709] < b[709],
+                 a[710] < b[710],
+                 a[711] < b[711],
+                 a[712] < b[712],
+                 a[713] < b[713],
+                 a[714] < b[714],
+                 a[715] < b[715],
+                 a[716] < b[716],
+                 a[717] < b[717],
+                 a[718] < b[718],
+                 a[719] < b[719],
+                 a[720] < b[720],
+                 a[721] < b[721],
+                 a[722] < b[722],
+                 a[723] < b[723],
+                 a[724] < b[724],
+                 a[725] < b[725],
+                 a[726] < b[726],
+                 a[727] < b[727],
+                 a[728] < b[728],
+                 a[729] < b[729],
+                 a[730] < b[730],
+                 a[731] < b[731],
+                 a[732] < b[732],
+                 a[733] < b[733],
+                 a[734] < b[734],
+                 a[735] < b[735],
+                 a[736] < b[736],
+                 a[737] < b[737],
+                 a[738] < b[738],
+                 a[739] < b[739],
+                 a[740] < b[740],
+                 a[741] < b[741],
+                 a[742] < b[742],
+                 a[743] < b[743],
+                 a[744] < b[744],
+                 a[745] < b[745],
+                 a[746] < b[746],
+                 a[747] < b[747],
+                 a[748] < b[748],
+                 a[749] < b[749],
+                 a[750] < b[750],
+                 a[751] < b[751],
+                 a[752] < b[752],
+                 a[753] < b[753],
+                 a[754] < b[754],
+                 a[755] < b[755],
+                 a[756] < b[756],
+                 a[757] < b[757],
+                 a[758] < b[758],
+                 a[759] < b[759],
+                 a[760] < b[760],
+                 a[761] < b[761],
+                 a[762] < b[762],
+                 a[763] < b[763],
+                 a[764] < b[764],
+                 a[765] < b[765],
+                 a[766] < b[766],
+                 a[767] < b[767],
+                 a[768] < b[768],
+                 a[769] < b[769],
+                 a[770] < b[770],
+                 a[771] < b[771],
+                 a[772] < b[772],
+                 a[773] < b[773],
+                 a[774] < b[774],
+                 a[775] < b[775],
+                 a[776] < b[776],
+                 a[777] < b[777],
+                 a[778] < b[778],
+                 a[779] < b[779],
+                 a[780] < b[780],
+                 a[781] < b[781],
+                 a[782] < b[782],
+                 a[783] < b[783],
+                 a[784] < b[784],
+                 a[785] < b[785],
+                 a[786] < b[786],
+                 a[787] < b[787],
+                 a[788] < b[788],
+                 a[789] < b[789],
+                 a[790] < b[790],
+                 a[791] < b[791],
+                 a[792] < b[792],
+                 a[793] < b[793],
+                 a[794] < b[794],
+                 a[795] < b[795],
+                 a[796] < b[796],
+                 a[797] < b[797],
+                 a[798] < b[798],
+                 a[799] < b[799],
+                 a[800] < b[800],
+                 a[801] < b[801],
+                 a[802] < b[802],
+                 a[803] < b[803],
+                 a[804] < b[804],
+                 a[805] < b[805],
+                 a[806] < b[806],
+                 a[807] < b[807],
+                 a[808] < b[808],
+                 a[809] < b[809],
+                 a[810] < b[810],
+                 a[811] < b[811],
+                 a[812] < b[812],
+                 a[813] < b[813],
+                 a[814] < b[814],
+                 a[815] < b[815],
+                 a[816] < b[816],
+                 a[817] < b[817],
+                 a[818] < b[818],
+                 a[819] < b[819],
+                 a[820] < b[820],
+                 a[821] < b[821],
+                 a[822] < b[822],
+                 a[823] < b[823],
+                 a[824] < b[824],
+                 a[825] < b[825],
+                 a[826] < b[826],
+                 a[827] < b[827],
+                 a[828] < b[828],
+                 a[829] < b[829],
+                 a[830] < b[830],
+                 a[831] < b[831],
+                 a[832] < b[832],
+                 a[833] < b[833],
+                 a[834] < b[834],
+                 a[835] < b[835],
+                 a[836] < b[836],
+                 a[837] < b[837],
+                 a[838] < b[838],
+                 a[839] < b[839],
+                 a[840] < b[840],
+                 a[841] < b[841],
+                 a[842] < b[842],
+                 a[843] < b[843],
+                 a[844] < b[844],
+                 a[845] < b[845],
+                 a[846] < b[846],
+                 a[847] < b[847],
+                 a[848] < b[848],
+                 a[849] < b[849],
+                 a[850] < b[850],
+                 a[851] < b[851],
+                 a[852] < b[852],
+                 a[853] < b[853],
+                 a[854] < b[854],
+                 a[855] < b[855],
+                 a[856] < b[856],
+                 a[857] < b[857],
+                 a[858] < b[858],
+                 a[859] < b[859],
+                 a[860] < b[860],
+                 a[861] < b[861],
+                 a[862] < b[862],
+                 a[863] < b[863],
+                 a[864] < b[864],
+                 a[865] < b[865],
+                 a[866] < b[866],
+                 a[867] < b[867],
+                 a[868] < b[868],
+                 a[869] < b[869],
+                 a[870] < b[870],
+                 a[871] < b[871],
+                 a[872] < b[872],
+                 a[873] < b[873],
+                 a[874] < b[874],
+                 a[875] < b[875],
+                 a[876] < b[876],
+                 a[877] < b[877],
+                 a[878] < b[878],
+                 a[879] < b[879],
+                 a[880] < b[880],
+                 a[881] < b[881],
+                 a[882] < b[882],
+                 a[883] < b[883],
+                 a[884] < b[884],
+                 a[885] < b[885],
+                 a[886] < b[886],
+                 a[887] < b[887],
+                 a[888] < b[888],
+                 a[889] < b[889],
+                 a[890] < b[890],
+                 a[891] < b[891],
+                 a[892] < b[892],
+                 a[893] < b[893],
+                 a[894] < b[894],
+                 a[895] < b[895],
+                 a[896] < b[896],
+                 a[897] < b[897],
+                 a[898] < b[898],
+                 a[899] < b[899],
+                 a[900] < b[900],
+                 a[901] < b[901],
+                 a[902] < b[902],
+                 a[903] < b[903],
+                 a[904] < b[904],
+                 a[905] < b[905],
+                 a[906] < b[906],
+                 a[907] < b[907],
+                 a[908] < b[908],
+                 a[909] < b[909],
+                 a[910] < b[910],
+                 a[911] < b[911],
+                 a[912] < b[912],
+                 a[913] < b[913],
+                 a[914] < b[914],
+                 a[915] < b[915],
+                 a[916] < b[916],
+                 a[917] < b[917],
+                 a[918] < b[918],
+                 a[919] < b[919],
+                 a[920] < b[920],
+                 a[921] < b[921],
+                 a[922] < b[922],
+                 a[923] < b[923],
+                 a[924] < b[924],
+                 a[925] < b[925],
+                 a[926] < b[926],
+                 a[927] < b[927],
+                 a[928] < b[928],
+                 a[929] < b[929],
+                 a[930] < b[930],
+                 a[931] < b[931],
+                 a[932] < b[932],
+                 a[933] < b[933],
+                 a[934] < b[934],
+                 a[935] < b[935],
+                 a[936] < b[936],
+                 a[937] < b[937],
+                 a[938] < b[938],
+                 a[939] < b[939],
+                 a[940] < b[940],
+                 a[941] < b[941],
+                 a[942] < b[942],
+                 a[943] < b[943],
+                 a[944] < b[944],
+                 a[945] < b[945],
+                 a[946] < b[946],
+                 a[947] < b[947],
+                 a[948] < b[948],
+                 a[949] < b[949],
+                 a[950] < b[950],
+                 a[951] < b[951],
+                 a[952] < b[952],
+                 a[953] < b[953],
+                 a[954] < b[954],
+                 a[955] < b[955],
+                 a[956] < b[956],
+                 a[957] < b[957],
+                 a[958] < b[958],
+                 a[959] < b[959],
+                 a[960] < b[960],
+                 a[961] < b[961],
+                 a[962] < b[962],
+                 a[963] < b[963],
+                 a[964] < b[964],
+                 a[965] < b[965],
+                 a[966] < b[966],
+                 a[967] < b[967],
+                 a[968] < b[968],
+                 a[969] < b[969],
+                 a[970] < b[970],
+                 a[971] < b[971],
+                 a[972] < b[972],
+                 a[973] < b[973],
+                 a[974] < b[974],
+                 a[975] < b[975],
+                 a[976] < b[976],
+                 a[977] < b[977],
+                 a[978] < b[978],
+                 a[979] < b[979],
+                 a[980] < b[980],
+                 a[981] < b[981],
+                 a[982] < b[982],
+                 a[983] < b[983],
+                 a[984] < b[984],
+                 a[985] < b[985],
+                 a[986] < b[986],
+                 a[987] < b[987],
+                 a[988] < b[988],
+                 a[989] < b[989],
+                 a[990] < b[990],
+                 a[991] < b[991],
+                 a[992] < b[992],
+                 a[993] < b[993],
+                 a[994] < b[994],
+                 a[995] < b[995],
+                 a[996] < b[996],
+                 a[997] < b[997],
+                 a[998] < b[998],
+                 a[999] < b[999],
+                 a[1000] < b[1000],
+                 a[1001] < b[1001],
+                 a[1002] < b[1002],
+                 a[1003] < b[1003],
+                 a[1004] < b[1004],
+                 a[1005] < b[1005],
+                 a[1006] < b[1006],
+                 a[1007] < b[1007],
+                 a[1008] < b[1008],
+                 a[1009] < b[1009],
+                 a[1010] < b[1010],
+                 a[1011] < b[1011],
+                 a[1012] < b[1012],
+                 a[1013] < b[1013],
+                 a[1014] < b[1014],
+                 a[1015] < b[1015],
+                 a[1016] < b[1016],
+                 a[1017] < b[1017],
+                 a[1018] < b[1018],
+                 a[1019] < b[1019],
+                 a[1020] < b[1020],
+                 a[1021] < b[1021],
+                 a[1022] < b[1022],
+                 a[1023] < b[1023],
+                 a[1024] < b[1024],
+                 a[1025] < b[1025],
+                 a[1026] < b[1026],
+                 a[1027] < b[1027],
+                 a[1028] < b[1028],
+                 a[1029] < b[1029],
+                 a[1030] < b[1030],
+                 a[1031] < b[1031],
+                 a[1032] < b[1032],
+                 a[1033] < b[1033],
+                 a[1034] < b[1034],
+                 a[1035] < b[1035],
+                 a[1036] < b[1036],
+                 a[1037] < b[1037],
+                 a[1038] < b[1038],
+                 a[1039] < b[1039],
+                 a[1040] < b[1040],
+                 a[1041] < b[1041],
+                 a[1042] < b[1042],
+                 a[1043] < b[1043],
+                 a[1044] < b[1044],
+                 a[1045] < b[1045],
+                 a[1046] < b[1046],
+                 a[1047] < b[1047],
+                 a[1048] < b[1048],
+                 a[1049] < b[1049],
+                 a[1050] < b[1050],
+                 a[1051] < b[1051],
+                 a[1052] < b[1052],
+                 a[1053] < b[1053],
+                 a[1054] < b[1054],
+                 a[1055] < b[1055],
+                 a[1056] < b[1056],
+                 a[1057] < b[1057],
+                 a[1058] < b[1058],
+                 a[1059] < b[1059],
+                 a[1060] < b[1060],
+                 a[1061] < b[1061],
+                 a[1062] < b[1062],
+                 a[1063] < b[1063],
+                 a[1064] < b[1064],
+                 a[1065] < b[1065],
+                 a[1066] < b[1066],
+                 a[1067] < b[1067],
+                 a[1068] < b[1068],
+                 a[1069] < b[1069],
+                 a[1070] < b[1070],
+                 a[1071] < b[1071],
+                 a[1072] < b[1072],
+                 a[1073] < b[1073],
+                 a[1074] < b[1074],
+                 a[1075] < b[1075],
+                 a[1076] < b[1076],
+                 a[1077] < b[1077],
+                 a[1078] < b[1078],
+                 a[1079] < b[1079],
+                 a[1080] < b[1080],
+                 a[1081] < b[1081],
+                 a[1082] < b[1082],
+                 a[1083] < b[1083],
+                 a[1084] < b[1084],
+                 a[1085] < b[1085],
+                 a[1086] < b[1086],
+                 a[1087] < b[1087],
+                 a[1088] < b[1088],
+                 a[1089] < b[1089],
+                 a[1090] < b[1090],
+                 a[1091] < b[1091],
+                 a[1092] < b[1092],
+                 a[1093] < b[1093],
+                 a[1094] < b[1094],
+                 a[1095] < b[1095],
+                 a[1096] < b[1096],
+                 a[1097] < b[1097],
+                 a[1098] < b[1098],
+                 a[1099] < b[1099],
+                 a[1100] < b[1100],
+                 a[1101] < b[1101],
+                 a[1102] < b[1102],
+                 a[1103] < b[1103],
+                 a[1104] < b[1104],
+                 a[1105] < b[1105],
+                 a[1106] < b[1106],
+                 a[1107] < b[1107],
+                 a[1108] < b[1108],
+                 a[1109] < b[1109],
+                 a[1110] < b[1110],
+                 a[1111] < b[1111],
+                 a[1112] < b[1112],
+                 a[1113] < b[1113],
+                 a[1114] < b[1114],
+                 a[1115] < b[1115],
+                 a[1116] < b[1116],
+                 a[1117] < b[1117],
+                 a[1118] < b[1118],
+                 a[1119] < b[1119],
+                 a[1120] < b[1120],
+                 a[1121] < b[1121],
+                 a[1122] < b[1122],
+                 a[1123] < b[1123],
+                 a[1124] < b[1124],
+                 a[1125] < b[1125],
+                 a[1126] < b[1126],
+                 a[1127] < b[1127],
+                 a[1128] < b[1128],
+                 a[1129] < b[1129],
+                 a[1130] < b[1130],
+                 a[1131] < b[1131],
+                 a[1132] < b[1132],
+                 a[1133] < b[1133],
+                 a[1134] < b[1134],
+                 a[1135] < b[1135],
+                 a[1136] < b[1136],
+                 a[1137] < b[1137],
+                 a[1138] < b[1138],
+                 a[1139] < b[1139],
+                 a[1140] < b[1140],
+                 a[1141] < b[1141],
+                 a[1142] < b[1142],
+                 a[1143] < b[1143],
+                 a[1144] < b[1144],
+                 a[1145] < b[1145],
+                 a[1146] < b[1146],
+                 a[1147] < b[1147],
+                 a[1148] < b[1148],
+                 a[1149] < b[1149],
+                 a[1150] < b[1150],
+                 a[1151] < b[1151],
+                 a[1152] < b[1152],
+                 a[1153] < b[1153],
+                 a[1154] < b[1154],
+                 a[1155] < b[1155],
+                 a[1156] < b[1156],
+                 a[1157] < b[1157],
+                 a[1158] < b[1158],
+                 a[1159] < b[1159],
+                 a[1160] < b[1160],
+                 a[1161] < b[1161],
+                 a[1162] < b[1162],
+                 a[1163] < b[1163],
+                 a[1164] < b[1164],
+                 a[1165] < b[1165],
+                 a[1166] < b[1166],
+                 a[1167] < b[1167],
+                 a[1168] < b[1168],
+                 a[1169] < b[1169],
+                 a[1170] < b[1170],
+                 a[1171] < b[1171],
+                 a[1172] < b[1172],
+                 a[1173] < b[1173],
+                 a[1174] < b[1174],
+                 a[1175] < b[1175],
+                 a[1176] < b[1176],
+                 a[1177] < b[1177],
+                 a[1178] < b[1178],
+                 a[1179] < b[1179],
+                 a[1180] < b[1180],
+                 a[1181] < b[1181],
+                 a[1182] < b[1182],
+                 a[1183] < b[1183],
+                 a[1184] < b[1184],
+                 a[1185] < b[1185],
+                 a[1186] < b[1186],
+                 a[1187] < b[1187],
+                 a[1188] < b[1188],
+                 a[1189] < b[1189],
+                 a[1190] < b[1190],
+                 a[1191] < b[1191],
+                 a[1192] < b[1192],
+                 a[1193] < b[1193],
+                 a[1194] < b[1194],
+                 a[1195] < b[1195],
+                 a[1196] < b[1196],
+                 a[1197] < b[1197],
+                 a[1198] < b[1198],
+                 a[1199] < b[1199],
+                 a[1200] < b[1200],
+                 a[1201] < b[1201],
+                 a[1202] < b[1202],
+                 a[1203] < b[1203],
+                 a[1204] < b[1204],
+                 a[1205] < b[1205],
+                 a[1206] < b[1206],
+                 a[1207] < b[1207],
+                 a[1208] < b[1208],
+                 a[1209] < b[1209],
+                 a[1210] < b[1210],
+                 a[1211] < b[1211],
+                 a[1212] < b[1212],
+                 a[1213] < b[1213],
+                 a[1214] < b[1214],
+                 a[1215] < b[1215],
+                 a[1216] < b[1216],
+                 a[1217] < b[1217],
+                 a[1218] < b[1218],
+                 a[1219] < b[1219],
+                 a[1220] < b[1220],
+                 a[1221] < b[1221],
+                 a[1222] < b[1222],
+                 a[1223] < b[1223],
+                 a[1224] < b[1224],
+                 a[1225] < b[1225],
+                 a[1226] < b[1226],
+                 a[1227] < b[1227],
+                 a[1228] < b[1228],
+                 a[1229] < b[1229],
+                 a[1230] < b[1230],
+                 a[1231] < b[1231],
+                 a[1232] < b[1232],
+                 a[1233] < b[1233],
+                 a[1234] < b[1234],
+                 a[1235] < b[1235],
+                 a[1236] < b[1236],
+                 a[1237] < b[1237],
+                 a[1238] < b[1238],
+                 a[1239] < b[1239],
+                 a[1240] < b[1240],
+                 a[1241] < b[1241],
+                 a[1242] < b[1242],
+                 a[1243] < b[1243],
+                 a[1244] < b[1244],
+                 a[1245] < b[1245],
+                 a[1246] < b[1246],
+                 a[1247] < b[1247],
+                 a[1248] < b[1248],
+                 a[1249] < b[1249],
+                 a[1250] < b[1250],
+                 a[1251] < b[1251],
+                 a[1252] < b[1252],
+                 a[1253] < b[1253],
+                 a[1254] < b[1254],
+                 a[1255] < b[1255],
+                 a[1256] < b[1256],
+                 a[1257] < b[1257],
+                 a[1258] < b[1258],
+                 a[1259] < b[1259],
+                 a[1260] < b[1260],
+                 a[1261] < b[1261],
+                 a[1262] < b[1262],
+                 a[1263] < b[1263],
+                 a[1264] < b[1264],
+                 a[1265] < b[1265],
+                 a[1266] < b[1266],
+                 a[1267] < b[1267],
+                 a[1268] < b[1268],
+                 a[1269] < b[1269],
+                 a[1270] < b[1270],
+                 a[1271] < b[1271],
+                 a[1272] < b[1272],
+                 a[1273] < b[1273],
+                 a[1274] < b[1274],
+                 a[1275] < b[1275],
+                 a[1276] < b[1276],
+                 a[1277] < b[1277],
+                 a[1278] < b[1278],
+                 a[1279] < b[1279],
+                 a[1280] < b[1280],
+                 a[1281] < b[1281],
+                 a[1282] < b[1282],
+                 a[1283] < b[1283],
+                 a[1284] < b[1284],
+                 a[1285] < b[1285],
+                 a[1286] < b[1286],
+                 a[1287] < b[1287],
+                 a[1288] < b[1288],
+                 a[1289] < b[1289],
+                 a[1290] < b[1290],
+                 a[1291] < b[1291],
+                 a[1292] < b[1292],
+                 a[1293] < b[1293],
+                 a[1294] < b[1294],
+                 a[1295] < b[1295],
+                 a[1296] < b[1296],
+                 a[1297] < b[1297],
+                 a[1298] < b[1298],
+                 a[1299] < b[1299],
+                 a[1300] < b[1300],
+                 a[1301] < b[1301],
+                 a[1302] < b[1302],
+                 a[1303] < b[1303],
+                 a[1304] < b[1304],
+                 a[1305] < b[1305],
+                 a[1306] < b[1306],
+                 a[1307] < b[1307],
+                 a[1308] < b[1308],
+                 a[1309] < b[1309],
+                 a[1310] < b[1310],
+                 a[1311] < b[1311],
+                 a[1312] < b[1312],
+                 a[1313] < b[1313],
+                 a[1314] < b[1314],
+                 a[1315] < b[1315],
+                 a[1316] < b[1316],
+                 a[1317] < b[1317],
+                 a[1318] < b[1318],
+                 a[1319] < b[1319],
+                 a[1320] < b[1320],
+                 a[1321] < b[1321],
+                 a[1322] < b[1322],
+                 a[1323] < b[1323],
+                 a[1324] < b[1324],
+                 a[1325] < b[1325],
+                 a[1326] < b[1326],
+                 a[1327] < b[1327],
+                 a[1328] < b[1328],
+                 a[1329] < b[1329],
+                 a[1330] < b[1330],
+                 a[1331] < b[1331],
+                 a[1332] < b[1332],
+                 a[1333] < b[1333],
+                 a[1334] < b[1334],
+                 a[1335] < b[1335],
+                 a[1336] < b[1336],
+                 a[1337] < b[1337],
+                 a[1338] < b[1338],
+                 a[1339] < b[1339],
+                 a[1340] < b[1340],
+                 a[1341] < b[1341],
+                 a[1342] < b[1342],
+                 a[1343] < b[1343],
+                 a[1344] < b[1344],
+                 a[1345] < b[1345],
+                 a[1346] < b[1346],
+                 a[1347] < b[1347],
+                 a[1348] < b[1348],
+                 a[1349] < b[1349],
+                 a[1350] < b[1350],
+                 a[1351] < b[1351],
+                 a[1352] < b[1352],
+                 a[1353] < b[1353],
+                 a[1354] < b[1354],
+                 a[1355] < b[1355],
+                 a[1356] < b[1356],
+                 a[1357] < b[1357],
+                 a[1358] < b[1358],
+                 a[1359] < b[1359],
+                 a[1360] < b[1360],
+                 a[1361] < b[1361],
+                 a[1362] < b[1362],
+                 a[1363] < b[1363],
+                 a[1364] < b[1364],
+                 a[1365] < b[1365],
+                 a[1366] < b[1366],
+                 a[1367] < b[1367],
+                 a[1368] < b[1368],
+                 a[1369] < b[1369],
+                 a[1370] < b[1370],
+                 a[1371] < b[1371],
+                 a[1372] < b[1372],
+                 a[1373] < b[1373],
+                 a[1374] < b[1374],
+                 a[1375] < b[1375],
+                 a[1376] < b[1376],
+                 a[1377] < b[1377],
+                 a[1378] < b[1378],
+                 a[1379] < b[1379],
+                 a[1380] < b[1380],
+                 a[1381] < b[1381],
+                 a[1382] < b[1382],
+                 a[1383] < b[1383],
+                 a[1384] < b[1384],
+                 a[1385] < b[1385],
+                 a[1386] < b[1386],
+                 a[1387] < b[1387],
+                 a[1388] < b[1388],
+                 a[1389] < b[1389],
+                 a[1390] < b[1390],
+                 a[1391] < b[1391],
+                 a[1392] < b[1392],
+                 a[1393] < b[1393],
+                 a[1394] < b[1394],
+                 a[1395] < b[1395],
+                 a[1396] < b[1396],
+                 a[1397] < b[1397],
+                 a[1398] < b[1398],
+                 a[1399] < b[1399],
+                 a[1400] < b[1400],
+                 a[1401] < b[1401],
+                 a[1402] < b[1402],
+                 a[1403] < b[1403],
+                 a[1404] < b[1404],
+                 a[1405] < b[1405],
+                 a[1406] < b[1406],
+                 a[1407] < b[1407],
+                 a[1408] < b[1408],
+                 a[1409] < b[1409],
+                 a[1410] < b[1410],
+                 a[1411] < b[1411],
+                 a[1412] < b[1412],
+                 a[1413] < b[1413],
+                 a[1414] < b[1414],
+                 a[1415] < b[1415],
+                 a[1416] < b[1416],
+                 a[1417] < b[1417],
+                 a[1418] < b[1418],
+                 a[1419] < b[1419],
+                 a[1420] < b[1420],
+                 a[1421] < b[1421],
+                 a[1422] < b[1422],
+                 a[1423] < b[1423],
+                 a[1424] < b[1424],
+                 a[1425] < b[1425],
+                 a[1426] < b[1426],
+                 a[1427] < b[1427],
+                 a[1428] < b[1428],
+                 a[1429] < b[1429],
+                 a[1430] < b[1430],
+                 a[1431] < b[1431],
+                 a[1432] < b[1432],
+                 a[1433] < b[1433],
+                 a[1434] < b[1434],
+                 a[1435] < b[1435],
+                 a[1436] < b[1436],
+                 a[1437] < b[1437],
+                 a[1438] < b[1438],
+                 a[1439] < b[1439],
+                 a[1440] < b[1440],
+                 a[1441] < b[1441],
+                 a[1442] < b[1442],
+                 a[1443] < b[1443],
+                 a[1444] < b[1444],
+                 a[1445] < b[1445],
+                 a[1446] < b[1446],
+                 a[1447] < b[1447],
+                 a[1448] < b[1448],
+                 a[1449] < b[1449],
+                 a[1450] < b[1450],
+                 a[1451] < b[1451],
+                 a[1452] < b[1452],
+                 a[1453] < b[1453],
+                 a[1454] < b[1454],
+                 a[1455] < b[1455],
+                 a[1456] < b[1456],
+                 a[1457] < b[1457],
+                 a[1458] < b[1458],
+                 a[1459] < b[1459],
+                 a[1460] < b[1460],
+                 a[1461] < b[1461],
+                 a[1462] < b[1462],
+                 a[1463] < b[1463],
+                 a[1464] < b[1464],
+                 a[1465] < b[1465],
+                 a[1466] < b[1466],
+                 a[1467] < b[1467],
+                 a[1468] < b[1468],
+                 a[1469] < b[1469],
+                 a[1470] < b[1470],
+                 a[1471] < b[1471],
+                 a[1472] < b[1472],
+                 a[1473] < b[1473],
+                 a[1474] < b[1474],
+                 a[1475] < b[1475],
+                 a[1476] < b[1476],
+                 a[1477] < b[1477],
+                 a[1478] < b[1478],
+                 a[1479] < b[1479],
+                 a[1480] < b[1480],
+                 a[1481] < b[1481],
+                 a[1482] < b[1482],
+                 a[1483] < b[1483],
+                 a[1484] < b[1484],
+                 a[1485] < b[1485],
+                 a[1486] < b[1486],
+                 a[1487] < b[1487],
+                 a[1488] < b[1488],
+                 a[1489] < b[1489],
+                 a[1490] < b[1490],
+                 a[1491] < b[1491],
+                 a[1492] < b[1492],
+                 a[1493] < b[1493],
+                 a[1494] < b[1494],
+                 a[1495] < b[1495],
+                 a[1496] < b[1496],
+                 a[1497] < b[1497],
+                 a[1498] < b[1498],
+                 a[1499] < b[1499]);
+}
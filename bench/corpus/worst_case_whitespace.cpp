@@ -0,0 +1,107 @@
+// Worst case for peekNextChar() and the other functions that find the next text.
+// Each character in a long run of whitespace searches to the end of the run.
+// Without the table of the next text the search is repeated for each character.
+
+void alignedCalls()
+{
+    call(a0                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b0                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a1                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b1                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a2                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b2                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a3                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b3                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a4                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b4                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a5                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b5                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a6                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b6                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a7                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b7                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a8                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b8                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a9                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b9                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a10                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b10                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a11                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b11                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a12                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b12                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a13                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b13                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a14                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b14                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a15                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b15                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a16                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b16                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a17                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b17                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a18                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b18                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a19                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b19                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a20                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b20                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a21                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b21                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a22                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b22                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a23                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b23                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a24                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b24                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a25                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b25                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a26                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b26                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a27                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b27                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a28                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b28                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a29                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b29                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a30                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b30                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a31                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b31                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a32                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b32                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a33                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b33                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a34                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b34                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a35                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b35                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a36                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b36                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a37                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b37                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a38                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b38                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a39                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b39                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a40                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b40                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a41                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b41                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a42                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b42                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a43                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b43                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a44                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b44                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a45                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b45                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a46                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b46                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a47                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b47                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a48                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b48                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a49                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b49                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a50                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b50                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a51                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b51                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a52                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b52                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a53                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b53                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a54                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b54                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a55                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b55                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a56                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b56                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a57                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b57                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a58                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b58                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a59                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b59                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a60                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b60                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a61                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b61                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a62                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b62                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a63                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b63                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a64                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b64                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a65                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b65                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a66                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b66                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a67                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b67                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a68                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b68                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a69                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b69                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a70                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b70                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a71                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b71                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a72                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b72                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a73                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b73                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a74                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b74                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a75                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b75                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a76                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b76                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a77                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b77                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a78                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b78                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a79                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b79                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a80                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b80                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a81                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b81                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a82                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b82                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a83                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b83                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a84                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b84                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a85                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b85                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a86                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b86                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a87                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b87                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a88                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b88                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a89                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b89                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a90                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b90                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a91                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b91                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a92                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b92                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a93                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b93                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a94                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b94                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a95                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b95                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a96                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b96                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a97                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b97                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a98                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b98                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+    call(a99                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        , b99                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        );                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                        // note
+}
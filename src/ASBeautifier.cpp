@@ -31,9 +31,6 @@
 
 namespace astyle {
 
-// this must be global
-static int g_preprocessorCppExternCBracket;
-
 /**
  * ASBeautifier's constructor
  * This constructor is called only once for each source file.
@@ -41,7 +38,8 @@ static int g_preprocessorCppExternCBracket;
  */
 ASBeautifier::ASBeautifier()
 {
-	g_preprocessorCppExternCBracket = 0;
+	// shared by the cloned ASBeautifier objects
+	preprocessorCppExternCBracket = new int(0);
 
 	waitingBeautifierStack = NULL;
 	activeBeautifierStack = NULL;
@@ -90,6 +88,7 @@ ASBeautifier::ASBeautifier()
 	preBlockStatements = new vector<const string*>;
 	preCommandHeaders = new vector<const string*>;
 	indentableHeaders = new vector<const string*>;
+	keywords = new vector<const string*>;
 }
 
 /**
@@ -151,6 +150,8 @@ ASBeautifier::ASBeautifier(const ASBeautifier &other) : ASBase(other)
 	preBlockStatements = other.preBlockStatements;
 	preCommandHeaders = other.preCommandHeaders;
 	indentableHeaders = other.indentableHeaders;
+	keywords = other.keywords;
+	preprocessorCppExternCBracket = other.preprocessorCppExternCBracket;
 
 	// protected variables
 	// variables set by ASFormatter
@@ -428,6 +429,7 @@ void ASBeautifier::initVectors()
 	preBlockStatements->clear();
 	preCommandHeaders->clear();
 	indentableHeaders->clear();
+	keywords->clear();
 
 	ASResource::buildHeaders(headers, fileType, true);
 	ASResource::buildNonParenHeaders(nonParenHeaders, fileType, true);
@@ -436,6 +438,7 @@ void ASBeautifier::initVectors()
 	ASResource::buildPreBlockStatements(preBlockStatements, fileType);
 	ASResource::buildPreCommandHeaders(preCommandHeaders, fileType);
 	ASResource::buildIndentableHeaders(indentableHeaders);
+	ASResource::buildKeywords(keywords);
 }
 
 /**
@@ -856,6 +859,7 @@ int ASBeautifier::getTabLength(void) const
  */
 string ASBeautifier::beautify(const string &originalLine)
 {
+	ASProfileTimer timer(ASProfiler::BEAUTIFY_PHASE);
 	string line;
 	bool isInQuoteContinuation = isInVerbatimQuote | haveLineContinuationChar;
 
@@ -941,8 +945,8 @@ string ASBeautifier::beautify(const string &originalLine)
 		if (j != string::npos && line.compare(j, 2, "/*") == 0)
 		{
 			lineOpensWithComment = true;
-			size_t k = line.find_first_not_of(" \t");
-			if (k != string::npos && line.compare(k, 1, "{") == 0)
+			// the trimmed line starts with the first text
+			if (line[0] == '{')
 				isInHorstmannComment = true;
 		}
 	}
@@ -1552,6 +1556,8 @@ void ASBeautifier::deleteBeautifierVectors()
 	delete assignmentOperators;
 	delete nonAssignmentOperators;
 	delete indentableHeaders;
+	delete keywords;
+	delete preprocessorCppExternCBracket;
 }
 
 /**
@@ -1983,8 +1989,8 @@ void ASBeautifier::processPreprocessor(const string &preproc, const string &line
 	}
 	else if (preproc.length() >= 2 && preproc.substr(0, 2) == "if")
 	{
-		if (isPreprocessorConditionalCplusplus(line) && !g_preprocessorCppExternCBracket)
-			g_preprocessorCppExternCBracket = 1;
+		if (isPreprocessorConditionalCplusplus(line) && !*preprocessorCppExternCBracket)
+			*preprocessorCppExternCBracket = 1;
 		// push a new beautifier into the stack
 		waitingBeautifierStackLengthStack->push_back(waitingBeautifierStack->size());
 		activeBeautifierStackLengthStack->push_back(activeBeautifierStack->size());
@@ -2169,7 +2175,7 @@ void ASBeautifier::computePreliminaryIndentation()
 
 	if (isInConditional)
 		--indentCount;
-	if (g_preprocessorCppExternCBracket >= 4)
+	if (*preprocessorCppExternCBracket >= 4)
 		--indentCount;
 }
 
@@ -2400,8 +2406,8 @@ void ASBeautifier::parseCurrentLine(const string &line)
 				else if (isSharpStyle() && prevCh == '@')
 					isInVerbatimQuote = true;
 				// check for "C" following "extern"
-				else if (g_preprocessorCppExternCBracket == 2 && line.compare(i, 3, "\"C\"") == 0)
-					++g_preprocessorCppExternCBracket;
+				else if (*preprocessorCppExternCBracket == 2 && line.compare(i, 3, "\"C\"") == 0)
+					++*preprocessorCppExternCBracket;
 			}
 			else if (isInVerbatimQuote && ch == '"')
 			{
@@ -2778,8 +2784,8 @@ void ASBeautifier::parseCurrentLine(const string &line)
 			}
 
 			blockTabCount += (isInStatement ? 1 : 0);
-			if (g_preprocessorCppExternCBracket == 3)
-				++g_preprocessorCppExternCBracket;
+			if (*preprocessorCppExternCBracket == 3)
+				++*preprocessorCppExternCBracket;
 			parenDepth = 0;
 			isInClassHeader = false;
 			isInClassHeaderTab = false;
@@ -2801,8 +2807,10 @@ void ASBeautifier::parseCurrentLine(const string &line)
 
 		//check if a header has been reached
 		bool isPotentialHeader = isCharPotentialHeader(line, i);
+		// only a keyword can be a header, other words bypass the searches
+		bool isKeyword = isPotentialHeader && getKeywordId(line, i, keywords) != NULL;
 
-		if (isPotentialHeader && !squareBracketCount)
+		if (isKeyword && !squareBracketCount)
 		{
 			const string* newHeader = findHeader(line, i, headers);
 
@@ -2976,7 +2984,7 @@ void ASBeautifier::parseCurrentLine(const string &line)
 			if (isSharpStyle() && findKeyword(line, i, AS_LET))
 				isInLet = true;
 
-		}   // isPotentialHeader
+		}   // isKeyword
 
 		if (ch == '?')
 			isInQuestion = true;
@@ -3182,7 +3190,7 @@ void ASBeautifier::parseCurrentLine(const string &line)
 					headerStack->pop_back();
 
 					if (headerStack->empty())
-						g_preprocessorCppExternCBracket = 0;
+						*preprocessorCppExternCBracket = 0;
 
 					// do not indent namespace bracket unless namespaces are indented
 					if (!namespaceIndent && !headerStack->empty()
@@ -3240,7 +3248,7 @@ void ASBeautifier::parseCurrentLine(const string &line)
 		{
 			// check for preBlockStatements in C/C++ ONLY if not within parentheses
 			// (otherwise 'struct XXX' statements would be wrongly interpreted...)
-			if (!isInTemplate && !(isCStyle() && parenDepth > 0))
+			if (isKeyword && !isInTemplate && !(isCStyle() && parenDepth > 0))
 			{
 				const string* newHeader = findHeader(line, i, preBlockStatements);
 				if (newHeader != NULL
@@ -3277,7 +3285,9 @@ void ASBeautifier::parseCurrentLine(const string &line)
 					continue;
 				}
 			}
-			const string* foundIndentableHeader = findHeader(line, i, indentableHeaders);
+			const string* foundIndentableHeader = NULL;
+			if (isKeyword)
+				foundIndentableHeader = findHeader(line, i, indentableHeaders);
 
 			if (foundIndentableHeader != NULL)
 			{
@@ -3291,41 +3301,44 @@ void ASBeautifier::parseCurrentLine(const string &line)
 				continue;
 			}
 
-			if (isCStyle() && findKeyword(line, i, AS_OPERATOR))
-				isInOperator = true;
-
-			if (g_preprocessorCppExternCBracket == 1 && findKeyword(line, i, AS_EXTERN))
-				++g_preprocessorCppExternCBracket;
-
-			if (g_preprocessorCppExternCBracket == 3)	// extern "C" is not followed by a '{'
-				g_preprocessorCppExternCBracket = 0;
+			if (*preprocessorCppExternCBracket == 3)	// extern "C" is not followed by a '{'
+				*preprocessorCppExternCBracket = 0;
 
-			// "new" operator is a pointer, not a calculation
-			if (findKeyword(line, i, AS_NEW))
+			if (isKeyword)
 			{
-				if (isInStatement && !inStatementIndentStack->empty() && prevNonSpaceCh == '=' )
-					inStatementIndentStack->back() = 0;
-			}
+				if (isCStyle() && findKeyword(line, i, AS_OPERATOR))
+					isInOperator = true;
 
-			if (isCStyle())
-			{
-				if (findKeyword(line, i, AS_ASM)
-				        || findKeyword(line, i, AS__ASM__))
+				if (*preprocessorCppExternCBracket == 1 && findKeyword(line, i, AS_EXTERN))
+					++*preprocessorCppExternCBracket;
+
+				// "new" operator is a pointer, not a calculation
+				if (findKeyword(line, i, AS_NEW))
 				{
-					isInAsm = true;
+					if (isInStatement && !inStatementIndentStack->empty() && prevNonSpaceCh == '=' )
+						inStatementIndentStack->back() = 0;
 				}
-				else if (findKeyword(line, i, AS_MS_ASM)		// microsoft specific
-				         || findKeyword(line, i, AS_MS__ASM))
-				{
-					int index = 4;
-					if (peekNextChar(line, i) == '_')		// check for __asm
-						index = 5;
 
-					char peekedChar = ASBase::peekNextChar(line, i + index);
-					if (peekedChar == '{' || peekedChar == ' ')
-						isInAsmBlock = true;
-					else
-						isInAsmOneLine = true;
+				if (isCStyle())
+				{
+					if (findKeyword(line, i, AS_ASM)
+					        || findKeyword(line, i, AS__ASM__))
+					{
+						isInAsm = true;
+					}
+					else if (findKeyword(line, i, AS_MS_ASM)		// microsoft specific
+					         || findKeyword(line, i, AS_MS__ASM))
+					{
+						int index = 4;
+						if (peekNextChar(line, i) == '_')		// check for __asm
+							index = 5;
+
+						char peekedChar = ASBase::peekNextChar(line, i + index);
+						if (peekedChar == '{' || peekedChar == ' ')
+							isInAsmBlock = true;
+						else
+							isInAsmOneLine = true;
+					}
 				}
 			}
 
@@ -25,6 +25,7 @@
  */
 
 #include "astyle.h"
+#include <algorithm>
 
 
 namespace astyle {
@@ -110,6 +111,7 @@ void ASEnhancer::init(int  _fileType,
  */
 void ASEnhancer::enhance(string &line, bool isInNamespace, bool isInPreprocessor, bool isInSQL)
 {
+	ASProfileTimer timer(ASProfiler::ENHANCE_PHASE);
 	shouldUnindentLine = true;
 	shouldUnindentComment = false;
 	lineNumber++;
@@ -142,26 +144,24 @@ void ASEnhancer::enhance(string &line, bool isInNamespace, bool isInPreprocessor
 		unindentNextLine = false;
 	}
 
+	// the first text is found once for the line
+	// an indent added below does not change the first text character
+	size_t firstText = line.find_first_not_of(" \t");
+	bool isPreprocessorLine = (firstText != string::npos && line[firstText] == '#');
+
 	// parse characters in the current line
-	parseCurrentLine(line, isInPreprocessor, isInSQL);
+	parseCurrentLine(line, firstText, isInPreprocessor, isInSQL);
 
 	// check for SQL indentable lines
-	if (isInDeclareSection)
-	{
-		size_t firstText = line.find_first_not_of(" \t");
-		if (firstText == string::npos || line[firstText] != '#')
-			indentLine(line, 1);
-	}
+	if (isInDeclareSection && !isPreprocessorLine)
+		indentLine(line, 1);
 
 	// check for event table indentable lines
 	if (isInEventTable
 	        && (eventPreprocDepth == 0
-	            || (namespaceIndent && isInNamespace)))
-	{
-		size_t firstText = line.find_first_not_of(" \t");
-		if (firstText == string::npos || line[firstText] != '#')
-			indentLine(line, 1);
-	}
+	            || (namespaceIndent && isInNamespace))
+	        && !isPreprocessorLine)
+		indentLine(line, 1);
 
 	if (shouldUnindentComment && sw.unindentDepth > 0)
 		unindentLine(line, sw.unindentDepth - 1);
@@ -177,17 +177,14 @@ void ASEnhancer::enhance(string &line, bool isInNamespace, bool isInPreprocessor
 void ASEnhancer::convertForceTabIndentToSpaces(string &line) const
 {
 	// replace tab indents with spaces
-	for (size_t i = 0; i < line.length(); i++)
-	{
-		if (!isWhiteSpace(line[i]))
-			break;
-		if (line[i] == '\t')
-		{
-			line.erase(i, 1);
-			line.insert(i, tabLength, ' ');
-			i += tabLength - 1;
-		}
-	}
+	// the indent is replaced at once instead of a tab at a time
+	size_t indentEnd = line.find_first_not_of(" \t");
+	if (indentEnd == string::npos)
+		indentEnd = line.length();
+	size_t tabCount = count(line.begin(), line.begin() + indentEnd, '\t');
+	if (tabCount == 0)
+		return;
+	line.replace(0, indentEnd, indentEnd + tabCount * (tabLength - 1), ' ');
 }
 
 /**
@@ -471,12 +468,13 @@ bool ASEnhancer::isOneLineBlockReached(string &line, int startChar) const
 /**
  * parse characters in the current line to determine if an indent
  * or unindent is needed.
+ * The leading whitespace is bypassed by starting at firstText.
  */
-void ASEnhancer::parseCurrentLine(string &line, bool isInPreprocessor, bool isInSQL)
+void ASEnhancer::parseCurrentLine(string &line, size_t firstText, bool isInPreprocessor, bool isInSQL)
 {
 	bool isSpecialChar = false;			// is a backslash escape character
 
-	for (size_t i = 0; i < line.length(); i++)
+	for (size_t i = firstText; i < line.length(); i++)
 	{
 		char ch = line[i];
 
@@ -527,7 +525,7 @@ void ASEnhancer::parseCurrentLine(string &line, bool isInPreprocessor, bool isIn
 			if (line.compare(i + 2, 1, "\xf0") > 0)
 				lineNumber--;
 			// unindent if not in case brackets
-			if (line.find_first_not_of(" \t") == i
+			if (i == firstText
 			        && sw.switchBracketCount == 1
 			        && sw.unindentCase)
 				shouldUnindentComment = true;
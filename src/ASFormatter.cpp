@@ -63,6 +63,7 @@ ASFormatter::ASFormatter()
 	shouldBreakOneLineStatements = true;
 	shouldConvertTabs = false;
 	shouldIndentCol1Comments = false;
+	shouldIndentOnly = false;
 	shouldIndentPreprocBlock = false;
 	shouldCloseTemplates = false;
 	shouldAttachExternC = false;
@@ -91,6 +92,7 @@ ASFormatter::ASFormatter()
 	operators = new vector<const string*>;
 	assignmentOperators = new vector<const string*>;
 	castOperators = new vector<const string*>;
+	keywords = new vector<const string*>;
 
 	// initialize ASEnhancer member vectors
 	indentableMacros = new vector<const pair<const string, const string>* >;
@@ -117,6 +119,7 @@ ASFormatter::~ASFormatter()
 	delete operators;
 	delete assignmentOperators;
 	delete castOperators;
+	delete keywords;
 
 	// delete ASEnhancer member vectors
 	delete indentableMacros;
@@ -165,10 +168,16 @@ void ASFormatter::init(ASSourceIterator* si)
 	initContainer(bracketTypeStack, new vector<BracketType>);
 	bracketTypeStack->push_back(NULL_TYPE); // bracketTypeStack must contain this default entry
 	clearFormattedLineSplitPoints();
+	peekTextCache.clear();
+	structAccessCache.clear();
+	preprocBlockCache.clear();
+	templateOpenerCache.clear();
 
 	currentHeader = NULL;
 	currentLine = "";
+	nextTextIndex.clear();
 	readyFormattedLine = "";
+	indentOnlyLine = "";
 	formattedLine = "";
 	verbatimDelimiter = "";
 	currentChar = ' ';
@@ -178,6 +187,7 @@ void ASFormatter::init(ASSourceIterator* si)
 	quoteChar = '"';
 	preprocBlockEnd = 0;
 	charNum = 0;
+	sourceLineNumber = 0;
 	checksumIn = 0;
 	checksumOut = 0;
 	currentLineFirstBracketNum = string::npos;
@@ -307,6 +317,7 @@ void ASFormatter::buildLanguageVectors()
 	operators->clear();
 	assignmentOperators->clear();
 	castOperators->clear();
+	keywords->clear();
 	indentableMacros->clear();	// ASEnhancer
 
 	ASResource::buildHeaders(headers, getFileType());
@@ -316,6 +327,7 @@ void ASFormatter::buildLanguageVectors()
 	ASResource::buildOperators(operators, getFileType());
 	ASResource::buildAssignmentOperators(assignmentOperators);
 	ASResource::buildCastOperators(castOperators);
+	ASResource::buildKeywords(keywords);
 	ASResource::buildIndentableMacros(indentableMacros);	//ASEnhancer
 }
 
@@ -429,6 +441,18 @@ void ASFormatter::fixOptionVariableConflicts()
 	// don't allow indent-classes and indent-modifiers
 	if (getClassIndent())
 		setModifierIndent(false);
+	// indent-only must not add, remove, or change lines
+	if (shouldIndentOnly)
+	{
+		setAddBracketsMode(false);
+		setAddOneLineBracketsMode(false);
+		setRemoveBracketsMode(false);
+		setBreakBlocksMode(false);
+		setBreakClosingHeaderBlocksMode(false);
+		setTabSpaceConversionMode(false);
+		setDeleteEmptyLinesMode(false);
+		maxCodeLength = string::npos;
+	}
 }
 
 /**
@@ -438,6 +462,7 @@ void ASFormatter::fixOptionVariableConflicts()
  */
 string ASFormatter::nextLine()
 {
+	ASProfileTimer timer(ASProfiler::FORMAT_PHASE);
 	const string* newHeader;
 	bool isInVirginLine = isVirgin;
 	isCharImmediatelyPostComment = false;
@@ -488,6 +513,8 @@ string ASFormatter::nextLine()
 			isFormattingModeOff = false;
 			breakLine();
 			formattedLine = currentLine;
+			if (shouldIndentOnly)
+				indentOnlyLine = currentLine;
 			charNum = (int) currentLine.length() - 1;
 			continue;
 		}
@@ -495,6 +522,8 @@ string ASFormatter::nextLine()
 		{
 			breakLine();
 			formattedLine = currentLine;
+			if (shouldIndentOnly)
+				indentOnlyLine = currentLine;
 			charNum = (int) currentLine.length() - 1;
 			continue;
 		}
@@ -505,6 +534,8 @@ string ASFormatter::nextLine()
 			if (isInLineBreak)			// is true if not the first line
 				breakLine();
 			formattedLine = currentLine;
+			if (shouldIndentOnly)
+				indentOnlyLine = currentLine;
 			charNum = (int)currentLine.length() - 1;
 			continue;
 		}
@@ -576,6 +607,7 @@ string ASFormatter::nextLine()
 			            || findKeyword(preproc, 0, "line")))
 			{
 				currentLine = rtrim(currentLine);	// trim the end only
+				nextTextIndex.clear();
 				// check for horstmann run-in
 				if (formattedLine.length() > 0 && formattedLine[0] == '{')
 				{
@@ -607,6 +639,7 @@ string ASFormatter::nextLine()
 		if (shouldRemoveNextClosingBracket && currentChar == '}')
 		{
 			currentLine[charNum] = currentChar = ' ';
+			nextTextIndex.clear();
 			shouldRemoveNextClosingBracket = false;
 			assert(adjustChecksumIn(-'}'));
 			// if the line is empty, delete it
@@ -661,6 +694,7 @@ string ASFormatter::nextLine()
 				size_t nextText = currentLine.find_first_not_of(" \t", charNum + 1);
 				if (nextText != string::npos)
 					currentLine.erase(charNum + 1, nextText - charNum - 1);
+				nextTextIndex.clear();
 			}
 			if (isIndentableProprocessorBlock
 			        && sourceIterator->tellg() >= preprocBlockEnd)
@@ -784,6 +818,7 @@ string ASFormatter::nextLine()
 						formattedLine.append(getIndentLength() - 1, ' ');
 						formattedLine.append(currentLine, commentStart, commentLength);
 						currentLine.erase(commentStart, commentLength);
+						nextTextIndex.clear();
 						testForTimeToSplitFormattedLine();
 					}
 				}
@@ -1030,12 +1065,14 @@ string ASFormatter::nextLine()
 
 		// look for headers
 		bool isPotentialHeader = isCharPotentialHeader(currentLine, charNum);
+		// only a keyword can be a header, other words bypass the searches
+		bool isKeyword = isPotentialHeader && getKeywordId(currentLine, charNum, keywords) != NULL;
 
 		if (isPotentialHeader && !isInTemplate && !squareBracketCount)
 		{
 			isNonParenHeader = false;
 			foundClosingHeader = false;
-			newHeader = findHeader(headers);
+			newHeader = isKeyword ? findHeader(headers) : NULL;
 
 			// Qt headers may be variables in C++
 			if (newHeader == &AS_FOREVER || newHeader == &AS_FOREACH)
@@ -1171,7 +1208,8 @@ string ASFormatter::nextLine()
 
 				continue;
 			}
-			else if ((newHeader = findHeader(preDefinitionHeaders)) != NULL
+			else if (isKeyword
+			         && (newHeader = findHeader(preDefinitionHeaders)) != NULL
 			         && parenStack->back() == 0
 			         && !isInEnum)		// not C++11 enum class
 			{
@@ -1189,7 +1227,7 @@ string ASFormatter::nextLine()
 
 				continue;
 			}
-			else if ((newHeader = findHeader(preCommandHeaders)) != NULL)
+			else if (isKeyword && (newHeader = findHeader(preCommandHeaders)) != NULL)
 			{
 				// a 'const' variable is not a preCommandHeader
 				if (previousNonWSChar != ';'
@@ -1197,7 +1235,7 @@ string ASFormatter::nextLine()
 				        && getPreviousWord(currentLine, charNum) != AS_STATIC)
 					foundPreCommandHeader = true;
 			}
-			else if ((newHeader = findHeader(castOperators)) != NULL)
+			else if (isKeyword && (newHeader = findHeader(castOperators)) != NULL)
 			{
 				foundCastOperator = true;
 				appendSequence(*newHeader);
@@ -1293,6 +1331,7 @@ string ASFormatter::nextLine()
 				appendSpacePad();
 				if ((int) currentLine.length() > charNum + 1 && !isWhiteSpace(currentLine[charNum + 1]))
 					currentLine.insert(charNum + 1, " ");
+				nextTextIndex.clear();
 			}
 
 			if (isClassInitializer())
@@ -1304,76 +1343,79 @@ string ASFormatter::nextLine()
 
 		if (isPotentialHeader && !isInTemplate)
 		{
-			if (findKeyword(currentLine, charNum, AS_NEW))
-				isInPotentialCalculation = false;
+			if (isCStyle() && isExecSQL(currentLine, charNum))
+				isInExecSQL = true;
 
-			if (findKeyword(currentLine, charNum, AS_RETURN))
+			if (isKeyword)
 			{
-				isInPotentialCalculation = true;	// return is the same as an = sign
-				isImmediatelyPostReturn = true;
-			}
+				if (findKeyword(currentLine, charNum, AS_NEW))
+					isInPotentialCalculation = false;
 
-			if (findKeyword(currentLine, charNum, AS_OPERATOR))
-				isImmediatelyPostOperator = true;
+				if (findKeyword(currentLine, charNum, AS_RETURN))
+				{
+					isInPotentialCalculation = true;	// return is the same as an = sign
+					isImmediatelyPostReturn = true;
+				}
 
-			if (findKeyword(currentLine, charNum, AS_ENUM))
-			{
-				size_t firstNum = currentLine.find_first_of("(){},/");
-				if (firstNum == string::npos
-				        || currentLine[firstNum] == '{'
-				        || currentLine[firstNum] == '/')
-					isInEnum = true;
-			}
+				if (findKeyword(currentLine, charNum, AS_OPERATOR))
+					isImmediatelyPostOperator = true;
 
-			if (isCStyle()
-			        && findKeyword(currentLine, charNum, AS_THROW)
-			        && previousCommandChar != ')'
-			        && !foundPreCommandHeader)      // 'const' throw()
-				isImmediatelyPostThrow = true;
+				if (findKeyword(currentLine, charNum, AS_ENUM))
+				{
+					size_t firstNum = currentLine.find_first_of("(){},/");
+					if (firstNum == string::npos
+					        || currentLine[firstNum] == '{'
+					        || currentLine[firstNum] == '/')
+						isInEnum = true;
+				}
 
-			if (isCStyle() && findKeyword(currentLine, charNum, AS_EXTERN) && isExternC())
-				isInExternC = true;
+				if (isCStyle()
+				        && findKeyword(currentLine, charNum, AS_THROW)
+				        && previousCommandChar != ')'
+				        && !foundPreCommandHeader)      // 'const' throw()
+					isImmediatelyPostThrow = true;
 
-			// Objective-C NSException macros are preCommandHeaders
-			if (isCStyle() && findKeyword(currentLine, charNum, AS_NS_DURING))
-				foundPreCommandMacro = true;
-			if (isCStyle() && findKeyword(currentLine, charNum, AS_NS_HANDLER))
-				foundPreCommandMacro = true;
+				if (isCStyle() && findKeyword(currentLine, charNum, AS_EXTERN) && isExternC())
+					isInExternC = true;
 
-			if (isCStyle() && isExecSQL(currentLine, charNum))
-				isInExecSQL = true;
+				// Objective-C NSException macros are preCommandHeaders
+				if (isCStyle() && findKeyword(currentLine, charNum, AS_NS_DURING))
+					foundPreCommandMacro = true;
+				if (isCStyle() && findKeyword(currentLine, charNum, AS_NS_HANDLER))
+					foundPreCommandMacro = true;
 
-			if (isCStyle())
-			{
-				if (findKeyword(currentLine, charNum, AS_ASM)
-				        || findKeyword(currentLine, charNum, AS__ASM__))
+				if (isCStyle())
 				{
-					isInAsm = true;
-				}
-				else if (findKeyword(currentLine, charNum, AS_MS_ASM)		// microsoft specific
-				         || findKeyword(currentLine, charNum, AS_MS__ASM))
-				{
-					int index = 4;
-					if (peekNextChar() == '_')	// check for __asm
-						index = 5;
+					if (findKeyword(currentLine, charNum, AS_ASM)
+					        || findKeyword(currentLine, charNum, AS__ASM__))
+					{
+						isInAsm = true;
+					}
+					else if (findKeyword(currentLine, charNum, AS_MS_ASM)		// microsoft specific
+					         || findKeyword(currentLine, charNum, AS_MS__ASM))
+					{
+						int index = 4;
+						if (peekNextChar() == '_')	// check for __asm
+							index = 5;
 
-					char peekedChar = ASBase::peekNextChar(currentLine, charNum + index);
-					if (peekedChar == '{' || peekedChar == ' ')
-						isInAsmBlock = true;
-					else
-						isInAsmOneLine = true;
+						char peekedChar = ASBase::peekNextChar(currentLine, charNum + index);
+						if (peekedChar == '{' || peekedChar == ' ')
+							isInAsmBlock = true;
+						else
+							isInAsmOneLine = true;
+					}
 				}
-			}
 
-			if (isJavaStyle()
-			        && (findKeyword(currentLine, charNum, AS_STATIC)
-			            && isNextCharOpeningBracket(charNum + 6)))
-				isJavaStaticConstructor = true;
+				if (isJavaStyle()
+				        && (findKeyword(currentLine, charNum, AS_STATIC)
+				            && isNextCharOpeningBracket(charNum + 6)))
+					isJavaStaticConstructor = true;
 
-			if (isSharpStyle()
-			        && (findKeyword(currentLine, charNum, AS_DELEGATE)
-			            || findKeyword(currentLine, charNum, AS_UNCHECKED)))
-				isSharpDelegate = true;
+				if (isSharpStyle()
+				        && (findKeyword(currentLine, charNum, AS_DELEGATE)
+				            || findKeyword(currentLine, charNum, AS_UNCHECKED)))
+					isSharpDelegate = true;
+			}
 
 			// append the entire name
 			string name = getCurrentWord(currentLine, charNum);
@@ -1959,6 +2001,17 @@ void ASFormatter::setTabSpaceConversionMode(bool state)
 	shouldConvertTabs = state;
 }
 
+/**
+ * set option to change only the indentation.
+ * The lines are not formatted and all formatting options are ignored.
+ *
+ * @param state        true = indent only, false = format.
+ */
+void ASFormatter::setIndentOnlyMode(bool state)
+{
+	shouldIndentOnly = state;
+}
+
 /**
  * set option to indent comments in column 1.
  *
@@ -2043,7 +2096,7 @@ void ASFormatter::goForward(int i)
 char ASFormatter::peekNextChar() const
 {
 	char ch = ' ';
-	size_t peekNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t peekNum = findNextText(charNum + 1);
 
 	if (peekNum == string::npos)
 		return ch;
@@ -2053,6 +2106,38 @@ char ASFormatter::peekNextChar() const
 	return ch;
 }
 
+/**
+ * find the next text in currentLine, the same as find_first_not_of(" \t", start).
+ * The result is read from a table of the next text for each position.
+ * The table is built when first needed and is cleared when currentLine
+ * is changed. It stays valid while formattedLine is built.
+ *
+ * @param start     the position to search from.
+ * @return          the position of the next text, or string::npos.
+ */
+size_t ASFormatter::findNextText(size_t start) const
+{
+	if (nextTextIndex.empty())
+	{
+		size_t lineLength = currentLine.length();
+		nextTextIndex.resize(lineLength + 1);
+		nextTextIndex[lineLength] = string::npos;
+		for (size_t i = lineLength; i > 0; i--)
+		{
+			if (isWhiteSpace(currentLine[i - 1]))
+				nextTextIndex[i - 1] = nextTextIndex[i];
+			else
+				nextTextIndex[i - 1] = i - 1;
+		}
+	}
+	assert(nextTextIndex.size() == currentLine.length() + 1);
+	size_t nextText = string::npos;
+	if (start < nextTextIndex.size())
+		nextText = nextTextIndex[start];
+	assert(nextText == currentLine.find_first_not_of(" \t", start));
+	return nextText;
+}
+
 /**
  * check if current placement is before a comment
  *
@@ -2061,7 +2146,7 @@ char ASFormatter::peekNextChar() const
 bool ASFormatter::isBeforeComment() const
 {
 	bool foundComment = false;
-	size_t peekNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t peekNum = findNextText(charNum + 1);
 
 	if (peekNum == string::npos)
 		return foundComment;
@@ -2079,7 +2164,7 @@ bool ASFormatter::isBeforeComment() const
 bool ASFormatter::isBeforeAnyComment() const
 {
 	bool foundComment = false;
-	size_t peekNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t peekNum = findNextText(charNum + 1);
 
 	if (peekNum == string::npos)
 		return foundComment;
@@ -2099,7 +2184,7 @@ bool ASFormatter::isBeforeAnyComment() const
 bool ASFormatter::isBeforeAnyLineEndComment(int startPos) const
 {
 	bool foundLineEndComment = false;
-	size_t peekNum = currentLine.find_first_not_of(" \t", startPos + 1);
+	size_t peekNum = findNextText(startPos + 1);
 
 	if (peekNum != string::npos)
 	{
@@ -2111,7 +2196,7 @@ bool ASFormatter::isBeforeAnyLineEndComment(int startPos) const
 			size_t endNum = currentLine.find("*/", peekNum + 2);
 			if (endNum != string::npos)
 			{
-				size_t nextChar = currentLine.find_first_not_of(" \t", endNum + 2);
+				size_t nextChar = findNextText(endNum + 2);
 				if (nextChar == string::npos)
 					foundLineEndComment = true;
 			}
@@ -2128,7 +2213,7 @@ bool ASFormatter::isBeforeAnyLineEndComment(int startPos) const
 bool ASFormatter::isBeforeMultipleLineEndComments(int startPos) const
 {
 	bool foundMultipleLineEndComment = false;
-	size_t peekNum = currentLine.find_first_not_of(" \t", startPos + 1);
+	size_t peekNum = findNextText(startPos + 1);
 
 	if (peekNum != string::npos)
 	{
@@ -2138,7 +2223,7 @@ bool ASFormatter::isBeforeMultipleLineEndComments(int startPos) const
 			size_t endNum = currentLine.find("*/", peekNum + 2);
 			if (endNum != string::npos)
 			{
-				size_t nextChar = currentLine.find_first_not_of(" \t", endNum + 2);
+				size_t nextChar = findNextText(endNum + 2);
 				if (nextChar != string::npos
 				        && currentLine.compare(nextChar, 2, "//") == 0)
 					foundMultipleLineEndComment = true;
@@ -2196,12 +2281,16 @@ bool ASFormatter::getNextLine(bool emptyLineWasDeleted /*false*/)
 {
 	if (sourceIterator->hasMoreLines())
 	{
+		// indent-only breaks the line only at the end of a source line
+		if (shouldIndentOnly && !isVirgin)
+			breakIndentOnlyLine();
 		if (appendOpeningBracket)
 			currentLine = "{";		// append bracket that was removed from the previous line
 		else
 		{
 			currentLine = sourceIterator->nextLine(emptyLineWasDeleted);
 			assert(computeChecksumIn(currentLine));
+			sourceLineNumber++;
 		}
 		// reset variables for new line
 		inLineNumber++;
@@ -2219,6 +2308,7 @@ bool ASFormatter::getNextLine(bool emptyLineWasDeleted /*false*/)
 
 		if (currentLine.length() == 0)
 			currentLine = string(" ");        // a null is inserted if this is not done
+		nextTextIndex.clear();
 
 		// unless reading in the first line of the file, break a new line.
 		if (!isVirgin)
@@ -2243,6 +2333,8 @@ bool ASFormatter::getNextLine(bool emptyLineWasDeleted /*false*/)
 		if (passedSemicolon)
 			isInExecSQL = false;
 		initNewLine();
+		if (shouldIndentOnly)
+			indentOnlyLine = currentLine.substr(charNum);
 
 		currentChar = currentLine[charNum];
 		if (isInHorstmannRunIn && previousNonWSChar == '{' && !isInComment)
@@ -2270,6 +2362,8 @@ bool ASFormatter::getNextLine(bool emptyLineWasDeleted /*false*/)
 	}
 	else
 	{
+		if (shouldIndentOnly && !endOfCodeReached)
+			breakIndentOnlyLine();
 		endOfCodeReached = true;
 		return false;
 	}
@@ -2306,6 +2400,7 @@ void ASFormatter::initNewLine()
 			{
 				size_t numSpaces = tabSize - ((tabCount_ + i) % tabSize);
 				currentLine.replace(i, 1, numSpaces, ' ');
+				nextTextIndex.clear();
 				tabCount_++;
 				i += tabSize - 1;
 			}
@@ -2436,6 +2531,38 @@ void ASFormatter::appendSequence(const string &sequence, bool canBreakLine)
 		testForTimeToSplitFormattedLine();
 }
 
+/**
+ * Append the text following the current character to the current formatted line.
+ * The text to the next stop character, or to the end of the line, is appended at once.
+ * It is used for comments and quotes, which do not have split points.
+ * The text past maxCodeLength is left to be appended by character.
+ * charNum and currentChar are left at the last character appended.
+ *
+ * @param stopChars        the characters that end the text.
+ */
+void ASFormatter::appendFollowingText(const char* stopChars)
+{
+	assert(isInComment || isInLineComment || isInQuote);
+	if (isInLineBreak || charNum + 1 >= (int) currentLine.length())
+		return;
+	size_t maxTextLength = string::npos;
+	if (maxCodeLength != string::npos)
+	{
+		if (formattedLine.length() >= maxCodeLength)
+			return;
+		maxTextLength = maxCodeLength - formattedLine.length();
+	}
+	size_t textEnd = currentLine.find_first_of(stopChars, charNum + 1);
+	if (textEnd == string::npos)
+		textEnd = currentLine.length();
+	size_t textLength = min(textEnd - charNum - 1, maxTextLength);
+	if (textLength == 0)
+		return;
+	formattedLine.append(currentLine, charNum + 1, textLength);
+	charNum += textLength;
+	currentChar = currentLine[charNum];
+}
+
 /**
  * Append an operator sequence to the current formatted line.
  * The formattedLine split points are updated.
@@ -2507,6 +2634,13 @@ void ASFormatter::appendSpaceAfter()
  */
 void ASFormatter::breakLine(bool isSplitLine /*false*/)
 {
+	// indent-only breaks only at the end of a source line
+	if (shouldIndentOnly)
+	{
+		isInLineBreak = false;
+		return;
+	}
+
 	isLineReady = true;
 	isInLineBreak = false;
 	spacePadNum = nextLineSpacePadNum;
@@ -2531,6 +2665,24 @@ void ASFormatter::breakLine(bool isSplitLine /*false*/)
 	}
 }
 
+/**
+ * break the line for indent-only at the end of a source line.
+ * The text appended by the formatter is discarded, and the source
+ * line is sent to ASBeautifier unchanged. The formatter state is
+ * the same as for formatting, so the line is indented the same.
+ */
+void ASFormatter::breakIndentOnlyLine()
+{
+	isLineReady = true;
+	isInLineBreak = false;
+	spacePadNum = 0;
+	nextLineSpacePadNum = 0;
+	readyFormattedLine = indentOnlyLine;
+	formattedLine.erase();
+	prependEmptyLine = false;
+	formattedLineCommentNum = string::npos;
+}
+
 /**
  * check if the currently reached open-bracket (i.e. '{')
  * opens a:
@@ -2815,7 +2967,7 @@ bool ASFormatter::isPointerOrReference() const
 	if (nextChar == '-'
 	        || nextChar == '+')
 	{
-		size_t nextNum = currentLine.find_first_not_of(" \t", charNum + 1);
+		size_t nextNum = findNextText(charNum + 1);
 		if (nextNum != string::npos)
 		{
 			if (currentLine.compare(nextNum, 2, "++") != 0
@@ -3247,16 +3399,23 @@ bool ASFormatter::isUniformInitializerBracket() const
 
 /**
  * get the next non-whitespace substring on following lines, bypassing all comments.
+ * the text found on a following line is saved in peekTextCache for each line passed,
+ * so a comment or blank lines are not searched again by the following calls.
+ * the cache is not used if the caller has already peeked (shouldReset is true).
  *
  * @param   firstLine   the first line to check
  * @return  the next non-whitespace substring.
  */
 string ASFormatter::peekNextText(const string &firstLine, bool endOnEmptyLine /*false*/, bool shouldReset /*false*/) const
 {
+	ASProfileTimer timer(ASProfiler::PEEK_PHASE);
 	bool isFirstLine = true;
 	bool needReset = shouldReset;
 	string nextLine_ = firstLine;
 	size_t firstChar = string::npos;
+	int peekLineNumber = sourceLineNumber;
+	vector<int> peekedKeys;             // cache keys of the lines passed
+	map<int, string>::const_iterator cached = peekTextCache.end();
 
 	// find the first non-blank text, bypassing all comments.
 	bool isInComment_ = false;
@@ -3266,6 +3425,14 @@ string ASFormatter::peekNextText(const string &firstLine, bool endOnEmptyLine /*
 			isFirstLine = false;
 		else
 		{
+			if (!shouldReset)
+			{
+				int key = (++peekLineNumber * 4) + (isInComment_ ? 2 : 0) + (endOnEmptyLine ? 1 : 0);
+				cached = peekTextCache.find(key);
+				if (cached != peekTextCache.end())
+					break;
+				peekedKeys.push_back(key);
+			}
 			nextLine_ = sourceIterator->peekNextLine();
 			needReset = true;
 		}
@@ -3303,12 +3470,23 @@ string ASFormatter::peekNextText(const string &firstLine, bool endOnEmptyLine /*
 		break;
 	}
 
-	if (firstChar == string::npos)
+	if (cached != peekTextCache.end())
+		nextLine_ = cached->second;
+	else if (firstChar == string::npos)
 		nextLine_ = "";
 	else
 		nextLine_ = nextLine_.substr(firstChar);
 	if (needReset)
 		sourceIterator->peekReset();
+
+	// save the text for the lines passed when the search was more than one line
+	// entries before the current line will not be used again
+	if (peekedKeys.size() > 1 || (peekedKeys.size() > 0 && cached != peekTextCache.end()))
+	{
+		peekTextCache.erase(peekTextCache.begin(), peekTextCache.lower_bound((sourceLineNumber + 1) * 4));
+		for (size_t i = 0; i < peekedKeys.size(); i++)
+			peekTextCache[peekedKeys[i]] = nextLine_;
+	}
 	return nextLine_;
 }
 
@@ -3647,7 +3825,7 @@ void ASFormatter::formatPointerOrReferenceToMiddle()
 	bool isAfterScopeResolution = previousNonWSChar == ':';
 	size_t charNumSave = charNum;
 	// if this is the last thing on the line
-	if (currentLine.find_first_not_of(" \t", charNum + 1) == string::npos)
+	if (findNextText(charNum + 1) == string::npos)
 	{
 		if (wsBefore == 0 && !isAfterScopeResolution)
 			formattedLine.append(1, ' ');
@@ -3752,7 +3930,7 @@ void ASFormatter::formatPointerOrReferenceToName()
 	bool isAfterScopeResolution = previousNonWSChar == ':';		// check for ::
 	// if this is not the last thing on the line
 	if (!isBeforeAnyComment()
-	        && (int) currentLine.find_first_not_of(" \t", charNum + 1) > charNum)
+	        && (int) findNextText(charNum + 1) > charNum)
 	{
 		// goForward() to convert tabs to spaces, if necessary,
 		// and move following characters to preceding characters
@@ -4024,6 +4202,7 @@ void ASFormatter::padParens(void)
 			if (spacesInsideToDelete > 0)
 			{
 				currentLine.erase(charNum + 1, spacesInsideToDelete);
+				nextTextIndex.clear();
 				spacePadNum -= spacesInsideToDelete;
 			}
 			// convert tab to space if requested
@@ -4031,6 +4210,7 @@ void ASFormatter::padParens(void)
 			        && (int) currentLine.length() > charNum + 1
 			        && currentLine[charNum + 1] == '\t')
 				currentLine[charNum + 1] = ' ';
+			nextTextIndex.clear();
 		}
 
 		// pad open paren inside
@@ -4118,12 +4298,15 @@ void ASFormatter::formatOpeningBracket(BracketType bracketType)
 		if (isBeforeAnyComment() && isOkToBreakBlock(bracketType))
 		{
 			// if comment is at line end leave the comment on this line
-			if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket)
+			// indent-only does not move the bracket
+			if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket
+			        && !shouldIndentOnly)
 			{
 				currentChar = ' ';              // remove bracket from current line
 				if (parenStack->size() > 1)
 					parenStack->pop_back();
 				currentLine[charNum] = currentChar;
+				nextTextIndex.clear();
 				appendOpeningBracket = true;    // append bracket to following line
 			}
 			// else put comment after the bracket
@@ -4200,6 +4383,7 @@ void ASFormatter::formatOpeningBracket(BracketType bracketType)
 					{
 						shouldBreakLineAtNextChar = true;
 						currentLine.insert(charNum + 1, charNum + 1, ' ');
+						nextTextIndex.clear();
 					}
 					else if (!isBeforeAnyComment())		// added in release 2.03
 					{
@@ -4390,7 +4574,8 @@ void ASFormatter::formatArrayBrackets(BracketType bracketType, bool isOpeningArr
 				else if (isBeforeAnyComment())
 				{
 					// do not break unless comment is at line end
-					if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket)
+					if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket
+					        && !shouldIndentOnly)
 					{
 						currentChar = ' ';              // remove bracket from current line
 						appendOpeningBracket = true;    // append bracket to following line
@@ -4416,7 +4601,8 @@ void ASFormatter::formatArrayBrackets(BracketType bracketType, bool isOpeningArr
 				else if (isBeforeAnyComment())
 				{
 					// do not break unless comment is at line end
-					if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket)
+					if (isBeforeAnyLineEndComment(charNum) && !currentLineBeginsWithBracket
+					        && !shouldIndentOnly)
 					{
 						currentChar = ' ';              // remove bracket from current line
 						appendOpeningBracket = true;    // append bracket to following line
@@ -4729,6 +4915,7 @@ void ASFormatter::convertTabToSpaces()
 	size_t tabSize = getTabLength();
 	size_t numSpaces = tabSize - ((tabIncrementIn + charNum) % tabSize);
 	currentLine.replace(charNum, 1, numSpaces, ' ');
+	nextTextIndex.clear();
 	currentChar = currentLine[charNum];
 }
 
@@ -4971,6 +5158,7 @@ void ASFormatter::formatCommentBody()
 		if (currentChar == '\t' && shouldConvertTabs)
 			convertTabToSpaces();
 		appendCurrentChar();
+		appendFollowingText("*\t");
 		++charNum;
 	}
 	if (shouldStripCommentPrefix)
@@ -5082,7 +5270,7 @@ void ASFormatter::formatCommentCloser()
 	appendSequence(AS_CLOSE_COMMENT);
 	goForward(1);
 	if (doesLineStartComment
-	        && (currentLine.find_first_not_of(" \t", charNum + 1) == string::npos))
+	        && (findNextText(charNum + 1) == string::npos))
 		lineEndsInCommentOnly = true;
 	if (peekNextChar() == '}'
 	        && previousCommandChar != ';'
@@ -5111,6 +5299,7 @@ void ASFormatter::formatLineCommentBody()
 		if (currentChar == '\t' && shouldConvertTabs)
 			convertTabToSpaces();
 		appendCurrentChar();
+		appendFollowingText("\t");
 		++charNum;
 	}
 
@@ -5311,12 +5500,14 @@ void ASFormatter::formatQuoteBody()
 	// tabs in quotes are NOT changed by convert-tabs
 	if (isInQuote && currentChar != '\\')
 	{
+		const char stopChars[] = { quoteChar, '\\', '\0' };
 		while (charNum + 1 < (int) currentLine.length()
 		        && currentLine[charNum + 1] != quoteChar
 		        && currentLine[charNum + 1] != '\\')
 		{
 			currentChar = currentLine[++charNum];
 			appendCurrentChar();
+			appendFollowingText(stopChars);
 		}
 	}
 }
@@ -5553,6 +5744,7 @@ bool ASFormatter::addBracketsToStatement()
 		currentLine.insert(nextSemiColon + 1, " }");
 	// add opening bracket
 	currentLine.insert(charNum, "{ ");
+	nextTextIndex.clear();
 	assert(computeChecksumIn("{}"));
 	currentChar = '{';
 	// remove extra spaces
@@ -5658,6 +5850,7 @@ bool ASFormatter::removeBracketsFromStatement()
 
 	// remove opening bracket
 	currentLine[charNum] = currentChar = ' ';
+	nextTextIndex.clear();
 	assert(adjustChecksumIn(-'{'));
 	if (needReset)
 		sourceIterator->peekReset();
@@ -5721,6 +5914,9 @@ size_t ASFormatter::findNextChar(string &line, char searchChar, int searchStart
 
 /**
  * Look ahead in the file to see if a struct has access modifiers.
+ * The results for the nested blocks are saved in structAccessCache.
+ * A nested block has the same result as the search from its bracket
+ * if the line number and the following text are the same.
  *
  * @param firstLine     a reference to the line to indent.
  * @param index         the current line index.
@@ -5736,6 +5932,16 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 	size_t bracketCount = 1;
 	string nextLine_ = firstLine.substr(index + 1);
 
+	// use the result saved by the search of an enclosing block
+	structAccessCache.erase(structAccessCache.begin(),
+	                        structAccessCache.lower_bound(make_pair(sourceLineNumber, string())));
+	map<pair<int, string>, bool>::const_iterator cached
+	    = structAccessCache.find(make_pair(sourceLineNumber, nextLine_));
+	if (cached != structAccessCache.end())
+		return cached->second;
+	int peekLineNumber = sourceLineNumber;
+	vector<pair<int, string> > nestedBlocks;    // the nested blocks not yet closed
+
 	// find the first non-blank text, bypassing all comments and quotes.
 	bool isInComment_ = false;
 	bool isInQuote_ = false;
@@ -5747,6 +5953,7 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 		else
 		{
 			nextLine_ = sourceIterator->peekNextLine();
+			peekLineNumber++;
 			needReset = true;
 		}
 		// parse the line
@@ -5791,9 +5998,19 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 			}
 			// handle brackets
 			if (nextLine_[i] == '{')
+			{
 				++bracketCount;
+				nestedBlocks.push_back(make_pair(peekLineNumber, nextLine_.substr(i + 1)));
+			}
 			if (nextLine_[i] == '}')
+			{
 				--bracketCount;
+				if (!nestedBlocks.empty())
+				{
+					structAccessCache[nestedBlocks.back()] = false;
+					nestedBlocks.pop_back();
+				}
+			}
 			if (bracketCount == 0)
 			{
 				if (needReset)
@@ -5807,6 +6024,9 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 				        || findKeyword(nextLine_, i, AS_PRIVATE)
 				        || findKeyword(nextLine_, i, AS_PROTECTED))
 				{
+					// the modifier is also in the nested blocks
+					for (size_t j = 0; j < nestedBlocks.size(); j++)
+						structAccessCache[nestedBlocks[j]] = true;
 					if (needReset)
 						sourceIterator->peekReset();
 					return true;
@@ -5817,6 +6037,8 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 		}	// end of for loop
 	}	// end of while loop
 
+	for (size_t j = 0; j < nestedBlocks.size(); j++)
+		structAccessCache[nestedBlocks[j]] = false;
 	if (needReset)
 		sourceIterator->peekReset();
 	return false;
@@ -5824,6 +6046,9 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 
 /**
 * Look ahead in the file to see if a preprocessor block is indentable.
+* The results for the nested blocks that start a line are saved in
+* preprocBlockCache. A nested block has the same result as the search
+* from its '#' if the line number and the following text are the same.
 *
 * @param firstLine     a reference to the line to indent.
 * @param index         the current line index.
@@ -5831,6 +6056,7 @@ bool ASFormatter::isStructAccessModified(string &firstLine, size_t index) const
 */
 bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 {
+	ASProfileTimer timer(ASProfiler::PREPROCESSOR_PHASE);
 	assert(firstLine[index] == '#');
 
 	bool isFirstLine = true;
@@ -5843,6 +6069,21 @@ bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 	int  lineParenCount = 0;
 	string nextLine_ = firstLine.substr(index);
 
+	// use the result saved by the search of an enclosing block
+	// the include guard check was done by the enclosing block
+	preprocBlockCache.erase(preprocBlockCache.begin(),
+	                        preprocBlockCache.lower_bound(make_pair(sourceLineNumber, string())));
+	map<pair<int, string>, streamoff>::const_iterator cached
+	    = preprocBlockCache.find(make_pair(sourceLineNumber, nextLine_));
+	if (cached != preprocBlockCache.end())
+	{
+		preprocBlockEnd = cached->second;
+		return (preprocBlockEnd != 0);
+	}
+	int peekLineNumber = sourceLineNumber;
+	vector<pair<int, string> > nestedBlocks;    // the nested blocks not yet closed
+	vector<int> nestedBlockIndents;             // numBlockIndents inside the nested blocks
+
 	// find end of the block, bypassing all comments and quotes.
 	bool isInComment_ = false;
 	bool isInQuote_ = false;
@@ -5854,6 +6095,7 @@ bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 		else
 		{
 			nextLine_ = sourceIterator->peekNextLine();
+			peekLineNumber++;
 			needReset = true;
 		}
 		// parse the line
@@ -5902,6 +6144,11 @@ bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 				if (preproc.length() >= 2 && preproc.substr(0, 2) == "if") // #if, #ifdef, #ifndef
 				{
 					numBlockIndents += 1;
+					if (numBlockIndents > 1 && nextLine_.find_first_not_of(" \t") == i)
+					{
+						nestedBlocks.push_back(make_pair(peekLineNumber, nextLine_.substr(i)));
+						nestedBlockIndents.push_back(numBlockIndents);
+					}
 					isInIndentableBlock = true;
 					// flag first preprocessor conditional for header include guard check
 					if (!processedFirstConditional)
@@ -5912,6 +6159,20 @@ bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 				}
 				else if (preproc == "endif")
 				{
+					// a nested block ending here is indentable unless the parens are unmatched
+					if (!nestedBlocks.empty() && nestedBlockIndents.back() == numBlockIndents)
+					{
+						streamoff blockEnd = 0;
+						if (lineParenCount == 0)
+						{
+							blockEnd = sourceIterator->tellg();
+							if (blockEnd < 0)
+								blockEnd = sourceIterator->getStreamLength();
+						}
+						preprocBlockCache[nestedBlocks.back()] = blockEnd;
+						nestedBlocks.pop_back();
+						nestedBlockIndents.pop_back();
+					}
 					if (numBlockIndents > 0)
 						numBlockIndents -= 1;
 					// must exit BOTH loops
@@ -5948,6 +6209,9 @@ bool ASFormatter::isIndentablePreprocessorBlock(string &firstLine, size_t index)
 			break;
 	}	// end of while loop
 EndOfWhileLoop:
+	// the nested blocks not closed are not indentable
+	for (size_t j = 0; j < nestedBlocks.size(); j++)
+		preprocBlockCache[nestedBlocks[j]] = 0;
 	preprocBlockEnd = sourceIterator->tellg();
 	if (preprocBlockEnd < 0)
 		preprocBlockEnd = sourceIterator->getStreamLength();
@@ -6053,6 +6317,7 @@ void ASFormatter::trimContinuationLine()
 			charNum = leadingChars;
 			if (currentLine.length() == 0)
 				currentLine = string(" ");        // a null is inserted if this is not done
+			nextTextIndex.clear();
 		}
 		if (i >= len)
 			charNum = 0;
@@ -6109,6 +6374,9 @@ bool ASFormatter::isImmediatelyPostCast() const
 /**
  * Determine if a < is a template definition or instantiation.
  * Sets the class variables isInTemplate and templateDepth.
+ * The results for the '<' found by the search are saved in templateOpenerCache.
+ * A following '<' has the same result as the search from its position
+ * if the line number and the following text are the same.
  */
 void ASFormatter::checkIfTemplateOpener()
 {
@@ -6131,6 +6399,23 @@ void ASFormatter::checkIfTemplateOpener()
 	templateDepth = 0;
 	string nextLine_ = currentLine.substr(charNum);
 
+	// use the result saved by the search from a previous '<'
+	templateOpenerCache.erase(templateOpenerCache.begin(),
+	                          templateOpenerCache.lower_bound(make_pair(sourceLineNumber, string())));
+	map<pair<int, string>, int>::const_iterator cached
+	    = templateOpenerCache.find(make_pair(sourceLineNumber, nextLine_));
+	if (cached != templateOpenerCache.end())
+	{
+		isInTemplate = (cached->second > 0);
+		templateDepth = cached->second;
+		return;
+	}
+	int peekLineNumber = sourceLineNumber;
+	// the '<' not yet decided, with the template and paren depths and the '<' count before it
+	vector<pair<int, string> > openers;
+	vector<pair<int, int> > openerDepths;
+	vector<int> openerCounts;
+
 	// find the angle brackets, bypassing all comments and quotes.
 	bool isInComment_ = false;
 	bool isInQuote_ = false;
@@ -6142,6 +6427,7 @@ void ASFormatter::checkIfTemplateOpener()
 		else
 		{
 			nextLine_ = sourceIterator->peekNextLine();
+			peekLineNumber++;
 			needReset = true;
 		}
 		// parse the line
@@ -6189,6 +6475,9 @@ void ASFormatter::checkIfTemplateOpener()
 			// not in a comment or quote
 			if (currentChar_ == '<')
 			{
+				openers.push_back(make_pair(peekLineNumber, nextLine_.substr(i)));
+				openerDepths.push_back(make_pair(templateDepth, parenDepth_));
+				openerCounts.push_back(maxTemplateDepth);
 				++templateDepth;
 				++maxTemplateDepth;
 				continue;
@@ -6196,6 +6485,17 @@ void ASFormatter::checkIfTemplateOpener()
 			else if (currentChar_ == '>')
 			{
 				--templateDepth;
+				// this closes the last '<' not yet decided
+				if (!openers.empty() && openerDepths.back().first == templateDepth)
+				{
+					if (openerDepths.back().second == parenDepth_)
+						templateOpenerCache[openers.back()] = maxTemplateDepth - openerCounts.back();
+					else
+						templateOpenerCache[openers.back()] = 0;
+					openers.pop_back();
+					openerDepths.pop_back();
+					openerCounts.pop_back();
+				}
 				if (templateDepth == 0)
 				{
 					if (parenDepth_ == 0)
@@ -6214,6 +6514,14 @@ void ASFormatter::checkIfTemplateOpener()
 					++parenDepth_;
 				else
 					--parenDepth_;
+				// the '<' inside the closed parens are not templates
+				while (!openers.empty() && openerDepths.back().second > parenDepth_)
+				{
+					templateOpenerCache[openers.back()] = 0;
+					openers.pop_back();
+					openerDepths.pop_back();
+					openerCounts.pop_back();
+				}
 				if (parenDepth_ >= 0)
 					continue;
 				// this is not a template -> leave...
@@ -6256,6 +6564,9 @@ void ASFormatter::checkIfTemplateOpener()
 
 	// goto needed to exit from two loops
 exitFromSearch:
+	// the search ended with the same result for the '<' not yet decided
+	for (size_t i = 0; i < openers.size(); i++)
+		templateOpenerCache[openers[i]] = 0;
 	if (needReset)
 		sourceIterator->peekReset();
 }
@@ -6674,7 +6985,7 @@ void ASFormatter::clearFormattedLineSplitPoints()
  */
 bool ASFormatter::pointerSymbolFollows() const
 {
-	size_t peekNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t peekNum = findNextText(charNum + 1);
 	if (peekNum == string::npos || currentLine.compare(peekNum, 2, "->") != 0)
 		return false;
 	return true;
@@ -6762,7 +7073,7 @@ int ASFormatter::getFormatterFileType() const
 const string* ASFormatter::getFollowingOperator() const
 {
 	// find next word
-	size_t nextNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t nextNum = findNextText(charNum + 1);
 	if (nextNum == string::npos)
 		return NULL;
 
@@ -6794,7 +7105,7 @@ bool ASFormatter::isArrayOperator() const
 	assert(isBracketType(bracketTypeStack->back(), ARRAY_TYPE));
 
 	// find next word
-	size_t nextNum = currentLine.find_first_not_of(" \t", charNum + 1);
+	size_t nextNum = findNextText(charNum + 1);
 	if (nextNum == string::npos)
 		return false;
 
@@ -6875,6 +7186,7 @@ void ASFormatter::padObjCMethodColon()
 		size_t i = charNum + 1;
 		while ((i < currentLine.length()) && isWhiteSpace(currentLine[i]))
 			currentLine.erase(i, 1);
+		nextTextIndex.clear();
 	}
 	else
 	{
@@ -6885,6 +7197,7 @@ void ASFormatter::padObjCMethodColon()
 			currentLine.erase(i, 1);
 		if (((int) currentLine.length() > charNum + 1) && !isWhiteSpace(currentLine[charNum + 1]))
 			currentLine.insert(charNum + 1, " ");
+		nextTextIndex.clear();
 	}
 }
 
@@ -88,8 +88,10 @@ namespace astyle {
 // ASLocalizer class methods.
 //----------------------------------------------------------------------------
 
-ASLocalizer::ASLocalizer()
+ASLocalizer::ASLocalizer(const ASLocalizer* mainLocalizer /*NULL*/)
 // Set the locale information.
+// A request console uses the language of the main console localizer.
+// The locale is not set again since other threads may be using it.
 {
 	// set language default values to english (ascii)
 	// this will be used if a locale or a language cannot be found
@@ -99,6 +101,16 @@ ASLocalizer::ASLocalizer()
 	m_subLangID.clear();
 	m_translation = NULL;
 
+	if (mainLocalizer != NULL)
+	{
+		m_localeName = mainLocalizer->m_localeName;
+		m_langID = mainLocalizer->m_langID;
+		m_lcid = mainLocalizer->m_lcid;
+		m_subLangID = mainLocalizer->m_subLangID;
+		setTranslationClass();
+		return;
+	}
+
 	// Not all compilers support the C++ function locale::global(locale(""));
 	// For testing on Windows change the "Region and Language" settings or use AppLocale.
 	// For testing on Linux change the LANG environment variable: LANG=fr_FR.UTF-8.
@@ -246,8 +258,7 @@ const char* ASLocalizer::settext(const char* textIn) const
 // Call the settext class and return the value.
 {
 	assert(m_translation);
-	const string stringIn = textIn;
-	return m_translation->translate(stringIn).c_str();
+	return m_translation->translate(textIn);
 }
 
 void ASLocalizer::setTranslationClass()
@@ -306,9 +317,11 @@ void ASLocalizer::setTranslationClass()
 
 void Translation::addPair(const string &english, const wstring &translated)
 // Add a string pair to the translation vector.
+// The multi-byte translation is converted here so "translate" does not change anything.
 {
 	pair<string, wstring> entry(english, translated);
 	m_translation.push_back(entry);
+	m_mbTranslation.push_back(convertToMultiByte(translated));
 }
 
 string Translation::convertToMultiByte(const wstring &wideStr) const
@@ -367,25 +380,22 @@ bool Translation::getWideTranslation(const string &stringIn, wstring &wideOut) c
 	return false;
 }
 
-string &Translation::translate(const string &stringIn) const
+const char* Translation::translate(const char* textIn) const
 // Translate a string.
-// Return a static string instead of a member variable so the method can have a "const" designation.
-// This allows "settext" to be called from a "const" method.
+// Return a multi-byte translation converted by addPair instead of a static string.
+// This allows "settext" to be called from several threads.
 {
-	static string mbTranslation;
-	mbTranslation.clear();
 	for (size_t i = 0; i < m_translation.size(); i++)
 	{
-		if (m_translation[i].first == stringIn)
+		if (m_translation[i].first == textIn)
 		{
-			mbTranslation = convertToMultiByte(m_translation[i].second);
+			if (!m_mbTranslation[i].empty())
+				return m_mbTranslation[i].c_str();
 			break;
 		}
 	}
 	// not found, return english
-	if (mbTranslation.empty())
-		mbTranslation = stringIn;
-	return mbTranslation;
+	return textIn;
 }
 
 //----------------------------------------------------------------------------
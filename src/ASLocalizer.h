@@ -46,7 +46,7 @@ class Translation;
 class ASLocalizer
 {
 	public:		// functions
-		ASLocalizer();
+		ASLocalizer(const ASLocalizer* mainLocalizer = NULL);
 		virtual ~ASLocalizer();
 		string getLanguageID() const;
 		const Translation* getTranslationClass() const;
@@ -85,12 +85,13 @@ class Translation
 		string convertToMultiByte(const wstring &wideStr) const;
 		size_t getTranslationVectorSize() const;
 		bool getWideTranslation(const string &stringIn, wstring &wideOut) const;
-		string &translate(const string &stringIn) const;
+		const char* translate(const char* textIn) const;
 
 	protected:
 		void addPair(const string &english, const wstring &translated);
 		// variables
 		vector<pair<string, wstring> > m_translation;		// translation vector
+		vector<string> m_mbTranslation;						// multi-byte translations of the vector
 };
 
 //----------------------------------------------------------------------------
@@ -27,6 +27,12 @@
 #include "astyle.h"
 #include <algorithm>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
 
 namespace astyle {
 
@@ -333,6 +339,65 @@ void ASResource::buildIndentableMacros(vector<const pair<const string, const str
 		indentableMacros->push_back(&macros[i]);
 }
 
+/**
+ * Build the vector of keywords.
+ * Contains all the headers, keywords and cast operators that are words.
+ * Used by BOTH ASFormatter.cpp and ASBeautifier.cpp
+ * A word that is not in the vector cannot be a header or keyword.
+ * The headers are added from the header vectors of every file type,
+ * so a new header cannot be missed.
+ *
+ * @param keywords      a reference to the vector to be built.
+ */
+void ASResource::buildKeywords(vector<const string*>* keywords)
+{
+	const int fileTypes[] = { C_TYPE, JAVA_TYPE, SHARP_TYPE };
+	size_t elements = sizeof(fileTypes) / sizeof(fileTypes[0]);
+	for (size_t i = 0; i < elements; i++)
+	{
+		buildHeaders(keywords, fileTypes[i], true);
+		buildNonParenHeaders(keywords, fileTypes[i], true);
+		buildPreBlockStatements(keywords, fileTypes[i]);
+		buildPreCommandHeaders(keywords, fileTypes[i]);
+		buildPreDefinitionHeaders(keywords, fileTypes[i]);
+	}
+	buildIndentableHeaders(keywords);
+	buildCastOperators(keywords);
+
+	// the keywords checked by findKeyword() that are not in a header vector
+	keywords->push_back(&AS_END);
+	keywords->push_back(&AS_SELECTOR);
+	keywords->push_back(&AS_EXTERN);
+	keywords->push_back(&AS_ENUM);
+	keywords->push_back(&AS_PUBLIC);
+	keywords->push_back(&AS_PROTECTED);
+	keywords->push_back(&AS_PRIVATE);
+	keywords->push_back(&AS_OPERATOR);
+	keywords->push_back(&AS_THROW);
+	keywords->push_back(&AS_LET);
+	keywords->push_back(&AS_NEW);
+
+	keywords->push_back(&AS_ASM);
+	keywords->push_back(&AS__ASM__);
+	keywords->push_back(&AS_MS_ASM);
+	keywords->push_back(&AS_MS__ASM);
+
+	keywords->push_back(&AS_CIN);
+	keywords->push_back(&AS_COUT);
+	keywords->push_back(&AS_CERR);
+
+	keywords->push_back(&AS_UNSAFE);
+	keywords->push_back(&AS_DELEGATE);
+	keywords->push_back(&AS_UNCHECKED);
+
+	keywords->push_back(&AS_NS_DURING);
+	keywords->push_back(&AS_NS_HANDLER);
+
+	// the header vectors of the file types have common entries
+	sort(keywords->begin(), keywords->end(), sortOnName);
+	keywords->erase(unique(keywords->begin(), keywords->end()), keywords->end());
+}
+
 /**
  * Build the vector of non-assignment operators.
  * Used by ONLY ASBeautifier.cpp
@@ -569,6 +634,18 @@ void ASResource::buildPreDefinitionHeaders(vector<const string*>* preDefinitionH
  *                             ASBase Functions
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+// set the file type and the legal name characters for the file type.
+// the characters are found once so isLegalNameChar does not check the file type.
+void ASBase::init(int fileTypeArg)
+{
+	baseFileType = fileTypeArg;
+	for (int ch = 0; ch < 128; ch++)
+		nameChars[ch] = (isalnum(ch)
+		                 || ch == '.' || ch == '_'
+		                 || (isJavaStyle() && ch == '$')
+		                 || (isSharpStyle() && ch == '@'));  // may be used as a prefix
+}
+
 // check if a specific line position contains a keyword.
 bool ASBase::findKeyword(const string &line, int i, const string &keyword) const
 {
@@ -592,6 +669,36 @@ bool ASBase::findKeyword(const string &line, int i, const string &keyword) const
 	return true;
 }
 
+// get the keyword id of the word at a specific line position
+// the id is the keyword in the sorted vector, or NULL if the word is not a keyword
+const string* ASBase::getKeywordId(const string &line, size_t index,
+                                   const vector<const string*>* keywords) const
+{
+	assert(isCharPotentialHeader(line, index));
+	size_t lineLength = line.length();
+	size_t wordEnd;
+	for (wordEnd = index; wordEnd < lineLength; wordEnd++)
+	{
+		if (!isLegalNameChar(line[wordEnd]))
+			break;
+	}
+	// binary search of the sorted vector
+	size_t first = 0;
+	size_t last = keywords->size();
+	while (first < last)
+	{
+		size_t middle = (first + last) / 2;
+		int result = line.compare(index, wordEnd - index, *(*keywords)[middle]);
+		if (result == 0)
+			return (*keywords)[middle];
+		if (result < 0)
+			last = middle;
+		else
+			first = middle + 1;
+	}
+	return NULL;
+}
+
 // get the current word on a line
 // index must point to the beginning of the word
 string ASBase::getCurrentWord(const string &line, size_t index) const
@@ -607,4 +714,224 @@ string ASBase::getCurrentWord(const string &line, size_t index) const
 	return line.substr(index, i - index);
 }
 
+//-----------------------------------------------------------------------------
+// ASProfiler class
+// phase times and trace events for the profile and trace options
+// the timer state is thread local, the trace events are saved by one thread
+//-----------------------------------------------------------------------------
+
+AS_THREAD_LOCAL bool ASProfiler::isEnabled = false;
+AS_THREAD_LOCAL bool ASProfiler::isTracing = false;
+AS_THREAD_LOCAL ASProfiler::PhaseStats ASProfiler::phaseStats[ASProfiler::PHASE_COUNT];
+AS_THREAD_LOCAL ASProfileTimer* ASProfiler::currentTimer = NULL;
+
+#ifdef ASTYLE_ALLOC_STATS
+// the program counters are atomic because the directory search uses threads
+// the thread counters are used for the allocations of a file or phase
+static ASProfiler::AllocStats g_allocStats = { 0, 0, 0, 0 };    // updated by operator new and delete
+static AS_THREAD_LOCAL size_t g_threadAllocations = 0;          // allocations of the current thread
+static AS_THREAD_LOCAL size_t g_threadBytes = 0;                // bytes allocated by the current thread
+
+// count an allocation of an allocation stats build
+void ASProfiler::addAllocation(size_t size)
+{
+	g_threadAllocations++;
+	g_threadBytes += size;
+	__sync_add_and_fetch(&g_allocStats.allocations, 1);
+	__sync_add_and_fetch(&g_allocStats.bytes, size);
+	size_t liveBytes = __sync_add_and_fetch(&g_allocStats.liveBytes, size);
+	size_t peakLiveBytes = g_allocStats.peakLiveBytes;
+	while (liveBytes > peakLiveBytes)
+	{
+		size_t previous = __sync_val_compare_and_swap(&g_allocStats.peakLiveBytes,
+		                                              peakLiveBytes, liveBytes);
+		if (previous == peakLiveBytes)
+			break;
+		peakLiveBytes = previous;
+	}
+}
+
+// count a delete of an allocation stats build
+void ASProfiler::removeAllocation(size_t size)
+{
+	__sync_sub_and_fetch(&g_allocStats.liveBytes, size);
+}
+#endif
+vector<ASProfiler::TraceEvent> ASProfiler::traceEvents;
+double ASProfiler::traceStartTime = 0;
+
+// clear the allocation counts of an allocation stats build
+// the peak is restarted from the current live bytes
+void ASProfiler::clearAllocStats()
+{
+#ifdef ASTYLE_ALLOC_STATS
+	g_allocStats.allocations = 0;
+	g_allocStats.bytes = 0;
+	g_allocStats.peakLiveBytes = g_allocStats.liveBytes;
+#endif
+}
+
+// save a trace event
+void ASProfiler::addTraceEvent(const char* name, const string &detail, int threadId,
+                               double startTime, double endTime)
+{
+	assert(isTracing);
+	TraceEvent event;
+	event.name = name;
+	event.detail = detail;
+	event.threadId = threadId;
+	event.startTime = startTime;
+	event.duration = endTime - startTime;
+	traceEvents.push_back(event);
+}
+
+// copy the allocation counters, they are zero unless this is an allocation stats build
+void ASProfiler::getAllocStats(AllocStats* stats)
+{
+#ifdef ASTYLE_ALLOC_STATS
+	*stats = g_allocStats;
+#else
+	stats->allocations = 0;
+	stats->bytes = 0;
+	stats->liveBytes = 0;
+	stats->peakLiveBytes = 0;
+#endif
+}
+
+// get the display name of a phase
+const char* ASProfiler::getPhaseName(int phase)
+{
+	static const char* phaseNames[PHASE_COUNT] =
+	{ "read", "format", "beautify", "enhance", "peek", "preprocessor", "write" };
+	assert(phase >= 0 && phase < PHASE_COUNT);
+	return phaseNames[phase];
+}
+
+// copy the accumulated phase times to an array of PHASE_COUNT entries
+void ASProfiler::getPhaseStats(PhaseStats* stats)
+{
+	for (int i = 0; i < PHASE_COUNT; i++)
+		stats[i] = phaseStats[i];
+}
+
+// copy the allocation counters with the allocations and bytes of the calling thread
+// a file or phase is formatted by one thread, so the other threads do not change its counts
+void ASProfiler::getThreadAllocStats(AllocStats* stats)
+{
+	getAllocStats(stats);
+#ifdef ASTYLE_ALLOC_STATS
+	stats->allocations = g_threadAllocations;
+	stats->bytes = g_threadBytes;
+#endif
+}
+
+// get a monotonic wall clock time in seconds from an unspecified start
+double ASProfiler::getTime()
+{
+#ifdef _WIN32
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return double(counter.QuadPart) / double(frequency.QuadPart);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1000000000.0;
+#endif
+}
+
+const vector<ASProfiler::TraceEvent> &ASProfiler::getTraceEvents()
+{ return traceEvents; }
+
+double ASProfiler::getTraceStartTime()
+{ return traceStartTime; }
+
+// the allocations are counted by a build with ASTYLE_ALLOC_STATS defined
+bool ASProfiler::hasAllocStats()
+{
+#ifdef ASTYLE_ALLOC_STATS
+	return true;
+#else
+	return false;
+#endif
+}
+
+// the lookahead phases have a trace event for each expensive call
+// the other phases are called for each line and would make the trace too large
+bool ASProfiler::isTracedPhase(int phase, double elapsed)
+{
+	const double minTraceTime = 0.00001;    // 10 microseconds
+	return ((phase == PEEK_PHASE || phase == PREPROCESSOR_PHASE) && elapsed >= minTraceTime);
+}
+
+// enable or disable the timers and clear the accumulated times
+void ASProfiler::setIsEnabled(bool state)
+{
+	assert(currentTimer == NULL);
+	isEnabled = state;
+	for (int i = 0; i < PHASE_COUNT; i++)
+	{
+		phaseStats[i].calls = 0;
+		phaseStats[i].totalTime = 0;
+		phaseStats[i].nestedTime = 0;
+		phaseStats[i].allocations = 0;
+		phaseStats[i].allocatedBytes = 0;
+		phaseStats[i].nestedAllocations = 0;
+		phaseStats[i].nestedBytes = 0;
+	}
+}
+
+// enable or disable saving trace events and clear the saved events
+// the timers must be enabled for the phase events
+void ASProfiler::setIsTracing(bool state)
+{
+	isTracing = state;
+	traceEvents.clear();
+	traceStartTime = getTime();
+}
+
+void ASProfileTimer::start(ASProfiler::Phase phaseArg)
+{
+	isRunning = true;
+	phase = phaseArg;
+	parent = ASProfiler::currentTimer;
+	ASProfiler::currentTimer = this;
+	startTime = ASProfiler::getTime();
+	startAllocations = 0;
+	startBytes = 0;
+#ifdef ASTYLE_ALLOC_STATS
+	startAllocations = g_threadAllocations;
+	startBytes = g_threadBytes;
+#endif
+}
+
+void ASProfileTimer::stop()
+{
+	double stopTime = ASProfiler::getTime();
+	double elapsed = stopTime - startTime;
+	// the counts are taken before the trace event is saved
+	size_t allocations = 0;
+	size_t bytes = 0;
+#ifdef ASTYLE_ALLOC_STATS
+	allocations = g_threadAllocations - startAllocations;
+	bytes = g_threadBytes - startBytes;
+#endif
+	if (ASProfiler::isTracing && ASProfiler::isTracedPhase(phase, elapsed))
+		ASProfiler::addTraceEvent(ASProfiler::getPhaseName(phase), string(), 0, startTime, stopTime);
+	ASProfiler::PhaseStats &stats = ASProfiler::phaseStats[phase];
+	stats.calls++;
+	stats.totalTime += elapsed;
+	stats.allocations += allocations;
+	stats.allocatedBytes += bytes;
+	if (parent != NULL)
+	{
+		ASProfiler::PhaseStats &parentStats = ASProfiler::phaseStats[parent->phase];
+		parentStats.nestedTime += elapsed;
+		parentStats.nestedAllocations += allocations;
+		parentStats.nestedBytes += bytes;
+	}
+	ASProfiler::currentTimer = parent;
+}
+
 }   // end namespace astyle
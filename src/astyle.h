@@ -36,6 +36,7 @@
 
 #include <cctype>
 #include <iostream>		// for cout
+#include <map>
 #include <string>
 #include <vector>
 
@@ -192,6 +193,133 @@ class ASSourceIterator
 		virtual streamoff tellg() = 0;
 };
 
+//-----------------------------------------------------------------------------
+// Class ASProfiler
+// Accumulates the times of the formatting phases for the profile option,
+// and the trace events for the trace option.
+// The phases are timed by ASProfileTimer objects. The timers are compiled
+// in, but only test a flag unless profiling has been enabled.
+// A console build with ASTYLE_ALLOC_STATS defined also counts the memory
+// allocations of the program, and of each phase.
+// The timer state is thread local, so each thread formatting a file has its
+// own phase times. The trace events are saved by the thread enabling them.
+//-----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#define AS_THREAD_LOCAL __declspec(thread)
+#else
+#define AS_THREAD_LOCAL __thread
+#endif
+
+class ASProfileTimer;
+
+class ASProfiler
+{
+	public:
+		enum Phase
+		{
+			READ_PHASE,
+			FORMAT_PHASE,
+			BEAUTIFY_PHASE,
+			ENHANCE_PHASE,
+			PEEK_PHASE,
+			PREPROCESSOR_PHASE,
+			WRITE_PHASE,
+			PHASE_COUNT
+		};
+		// the accumulated times of a phase
+		// the allocations are counted only by an allocation stats build
+		struct PhaseStats
+		{
+			int    calls;                   // number of times the phase was entered
+			double totalTime;               // seconds including the nested phases
+			double nestedTime;              // seconds in the nested phases
+			size_t allocations;             // allocations including the nested phases
+			size_t allocatedBytes;          // bytes allocated including the nested phases
+			size_t nestedAllocations;       // allocations in the nested phases
+			size_t nestedBytes;             // bytes allocated in the nested phases
+		};
+		// the allocation counters of an allocation stats build
+		struct AllocStats
+		{
+			size_t allocations;             // number of allocations
+			size_t bytes;                   // bytes allocated
+			size_t liveBytes;               // bytes not yet deleted
+			size_t peakLiveBytes;           // maximum of the live bytes
+		};
+		// a span of the trace option
+		struct TraceEvent
+		{
+			const char* name;               // name of the span
+			string detail;                  // file or directory name, or empty
+			int    threadId;                // 0 for the console, or the search thread
+			double startTime;               // start time in seconds
+			double duration;                // duration in seconds
+		};
+
+	public:
+		static void addTraceEvent(const char* name, const string &detail, int threadId,
+		                          double startTime, double endTime);
+		static void clearAllocStats();
+		static void getAllocStats(AllocStats* stats);
+		static bool getIsEnabled() { return isEnabled; }
+		static bool getIsTracing() { return isTracing; }
+		static const char* getPhaseName(int phase);
+		static void getPhaseStats(PhaseStats* stats);
+		static void getThreadAllocStats(AllocStats* stats);
+		static double getTime();
+		static const vector<TraceEvent> &getTraceEvents();
+		static double getTraceStartTime();
+		static bool hasAllocStats();
+		static void setIsEnabled(bool state);
+		static void setIsTracing(bool state);
+#ifdef ASTYLE_ALLOC_STATS
+		static void addAllocation(size_t size);
+		static void removeAllocation(size_t size);
+#endif
+
+	private:
+		friend class ASProfileTimer;
+		static bool isTracedPhase(int phase, double elapsed);
+		static AS_THREAD_LOCAL bool isEnabled;                      // timers are active
+		static AS_THREAD_LOCAL bool isTracing;                      // trace events are saved
+		static AS_THREAD_LOCAL PhaseStats phaseStats[PHASE_COUNT];  // accumulated times
+		static AS_THREAD_LOCAL ASProfileTimer* currentTimer;        // innermost running timer
+		static vector<TraceEvent> traceEvents;                      // saved trace events
+		static double traceStartTime;                               // start time of the trace
+};
+
+//-----------------------------------------------------------------------------
+// Class ASProfileTimer
+// A scoped timer for a phase. The time is added to the phase when the
+// timer goes out of scope, and to the nested time of the enclosing timer.
+//-----------------------------------------------------------------------------
+
+class ASProfileTimer
+{
+	public:
+		ASProfileTimer(ASProfiler::Phase phaseArg) : isRunning(false) {
+			if (ASProfiler::isEnabled)
+				start(phaseArg);
+		}
+		~ASProfileTimer() {
+			if (isRunning)
+				stop();
+		}
+
+	private:
+		ASProfileTimer(const ASProfileTimer &copy);      // not to be implemented
+		ASProfileTimer &operator=(ASProfileTimer &);     // not to be implemented
+		void start(ASProfiler::Phase phaseArg);
+		void stop();
+		bool isRunning;                     // the timer was started
+		ASProfiler::Phase phase;            // phase being timed
+		ASProfileTimer* parent;             // enclosing timer, or NULL
+		double startTime;                   // start time in seconds
+		size_t startAllocations;            // allocation count at the start
+		size_t startBytes;                  // allocated bytes at the start
+};
+
 //-----------------------------------------------------------------------------
 // Class ASResource
 //-----------------------------------------------------------------------------
@@ -206,6 +334,7 @@ class ASResource
 		void buildHeaders(vector<const string*>* headers, int fileType, bool beautifier = false);
 		void buildIndentableMacros(vector<const pair<const string, const string>* >* indentableMacros);
 		void buildIndentableHeaders(vector<const string*>* indentableHeaders);
+		void buildKeywords(vector<const string*>* keywords);
 		void buildNonAssignmentOperators(vector<const string*>* nonAssignmentOperators);
 		void buildNonParenHeaders(vector<const string*>* nonParenHeaders, int fileType, bool beautifier = false);
 		void buildOperators(vector<const string*>* operators, int fileType);
@@ -264,17 +393,20 @@ class ASBase
 	private:
 		// all variables should be set by the "init" function
 		int baseFileType;      // a value from enum FileType
+		bool nameChars[128];   // the legal name characters for the file type
 
 	protected:
-		ASBase() : baseFileType(C_TYPE) { }
+		ASBase() { init(C_TYPE); }
 		virtual ~ASBase() {}
 
 		// functions definitions are at the end of ASResource.cpp
 		bool findKeyword(const string &line, int i, const string &keyword) const;
 		string getCurrentWord(const string &line, size_t index) const;
+		const string* getKeywordId(const string &line, size_t index,
+		                           const vector<const string*>* keywords) const;
 
 	protected:
-		void init(int fileTypeArg) { baseFileType = fileTypeArg; }
+		void init(int fileTypeArg);
 		bool isCStyle() const { return (baseFileType == C_TYPE); }
 		bool isJavaStyle() const { return (baseFileType == JAVA_TYPE); }
 		bool isSharpStyle() const { return (baseFileType == SHARP_TYPE); }
@@ -286,13 +418,10 @@ class ASBase
 		}
 
 		// check if a specific character can be used in a legal variable/method/class name
+		// the characters for the file type are set by the "init" function
 		bool isLegalNameChar(char ch) const {
-			if (isWhiteSpace(ch)) return false;
 			if ((unsigned) ch > 127) return false;
-			return (isalnum((unsigned char)ch)
-			        || ch == '.' || ch == '_'
-			        || (isJavaStyle() && ch == '$')
-			        || (isSharpStyle() && ch == '@'));  // may be used as a prefix
+			return nameChars[(unsigned) ch];
 		}
 
 		// check if a specific character can be part of a header
@@ -413,6 +542,7 @@ class ASBeautifier : protected ASResource, protected ASBase
 		bool isInIndentablePreproc;
 
 	private:  // functions
+		friend class ASMicroBench;      // bench/astyle_microbench.cpp
 		ASBeautifier(const ASBeautifier &copy);
 		ASBeautifier &operator=(ASBeautifier &);       // not to be implemented
 
@@ -456,6 +586,8 @@ class ASBeautifier : protected ASResource, protected ASBase
 		vector<const string*>* assignmentOperators;
 		vector<const string*>* nonAssignmentOperators;
 		vector<const string*>* indentableHeaders;
+		vector<const string*>* keywords;
+		int* preprocessorCppExternCBracket;		// shared with the cloned objects
 
 		vector<ASBeautifier*>* waitingBeautifierStack;
 		vector<ASBeautifier*>* activeBeautifierStack;
@@ -581,6 +713,7 @@ class ASEnhancer : protected ASBase
 		void enhance(string &line, bool isInNamespace, bool isInPreprocessor, bool isInSQL);
 
 	private:  // functions
+		friend class ASMicroBench;      // bench/astyle_microbench.cpp
 		void    convertForceTabIndentToSpaces(string  &line) const;
 		void    convertSpaceIndentToForceTab(string &line) const;
 		size_t  findCaseColon(string  &line, size_t caseIndex) const;
@@ -588,7 +721,7 @@ class ASEnhancer : protected ASBase
 		bool    isBeginDeclareSectionSQL(string  &line, size_t index) const;
 		bool    isEndDeclareSectionSQL(string  &line, size_t index) const;
 		bool    isOneLineBlockReached(string &line, int startChar) const;
-		void    parseCurrentLine(string &line, bool isInPreprocessor, bool isInSQL);
+		void    parseCurrentLine(string &line, size_t firstText, bool isInPreprocessor, bool isInSQL);
 		size_t  processSwitchBlock(string  &line, size_t index);
 		int     unindentLine(string  &line, int unindent) const;
 
@@ -676,6 +809,7 @@ class ASFormatter : public ASBeautifier
 		void setCloseTemplatesMode(bool state);
 		void setDeleteEmptyLinesMode(bool state);
 		void setIndentCol1CommentsMode(bool state);
+		void setIndentOnlyMode(bool state);
 		void setLineEndFormat(LineEndFormat fmt);
 		void setMaxCodeLength(int max);
 		void setObjCColonPaddingMode(ObjCColonPad mode);
@@ -697,11 +831,13 @@ class ASFormatter : public ASBeautifier
 		int  getFormatterFileType() const;
 
 	private:  // functions
+		friend class ASMicroBench;      // bench/astyle_microbench.cpp
 		ASFormatter(const ASFormatter &copy);       // copy constructor not to be implemented
 		ASFormatter &operator=(ASFormatter &);      // assignment operator not to be implemented
 		template<typename T> void deleteContainer(T &container);
 		template<typename T> void initContainer(T &container, T value);
 		char peekNextChar() const;
+		size_t findNextText(size_t start) const;
 		BracketType getBracketType();
 		bool adjustChecksumIn(int adjustment);
 		bool computeChecksumIn(const string &currentLine_);
@@ -748,11 +884,13 @@ class ASFormatter : public ASBeautifier
 		void adjustComments();
 		void appendChar(char ch, bool canBreakLine);
 		void appendCharInsideComments();
+		void appendFollowingText(const char* stopChars);
 		void appendOperator(const string &sequence, bool canBreakLine = true);
 		void appendSequence(const string &sequence, bool canBreakLine = true);
 		void appendSpacePad();
 		void appendSpaceAfter();
 		void breakLine(bool isSplitLine = false);
+		void breakIndentOnlyLine();
 		void buildLanguageVectors();
 		void updateFormattedLineSplitPoints(char appendedChar);
 		void updateFormattedLineSplitPointsOperator(const string &sequence);
@@ -809,6 +947,7 @@ class ASFormatter : public ASBeautifier
 		vector<const string*>* operators;
 		vector<const string*>* assignmentOperators;
 		vector<const string*>* castOperators;
+		vector<const string*>* keywords;
 		vector<const pair<const string, const string>* >* indentableMacros;	// for ASEnhancer
 
 		ASSourceIterator* sourceIterator;
@@ -820,9 +959,26 @@ class ASFormatter : public ASBeautifier
 		vector<bool>* structStack;
 		vector<bool>* questionMarkStack;
 
+		// peekNextText results for the lines following the current line
+		// the key is the source line number times 4, plus 2 if in a comment, plus 1 if ending on an empty line
+		mutable map<int, string> peekTextCache;
+		// look ahead results for the blocks nested in a block that was searched
+		// the key is the source line number and the text following the bracket or '#'
+		// a preprocessor block has the end position, or 0 if it is not indentable
+		mutable map<pair<int, string>, bool> structAccessCache;
+		map<pair<int, string>, streamoff> preprocBlockCache;
+		// checkIfTemplateOpener results for the '<' following a '<' that was searched
+		// the key is the source line number and the text starting with the '<'
+		// the value is the template depth, or 0 if it is not a template
+		map<pair<int, string>, int> templateOpenerCache;
+
 		string currentLine;
+		// the position of the next text for each position in currentLine
+		// it is built by findNextText and cleared when currentLine is changed
+		mutable vector<size_t> nextTextIndex;
 		string formattedLine;
 		string readyFormattedLine;
+		string indentOnlyLine;             // the source line for indent-only
 		string verbatimDelimiter;
 		const string* currentHeader;
 		const string* previousOperator;    // used ONLY by pad-oper
@@ -833,6 +989,7 @@ class ASFormatter : public ASBeautifier
 		char quoteChar;
 		streamoff preprocBlockEnd;
 		int  charNum;
+		int  sourceLineNumber;          // lines read from the sourceIterator
 		int  horstmannIndentChars;
 		int  nextLineSpacePadNum;
 		int  preprocBracketTypeStackSize;
@@ -960,6 +1117,7 @@ class ASFormatter : public ASBeautifier
 		bool shouldPadMethodPrefix;
 		bool shouldUnPadMethodPrefix;
 		bool shouldDeleteEmptyLines;
+		bool shouldIndentOnly;
 		bool needHeaderOpeningBracket;
 		bool shouldBreakLineAtNextChar;
 		bool shouldKeepLineUnbroken;
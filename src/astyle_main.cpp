@@ -30,9 +30,17 @@
     ---------------------------------------
     namespace astyle {
     ASStreamIterator methods
+    ASProfiler methods
+    ASRecordIO methods
+    ASWildcard methods
+    ASIgnoreRules methods
     ASConsole methods
         // Windows specific
         // Linux specific
+    ASServer methods
+        // Linux specific
+    ASDirectoryWalker methods
+        // Linux specific
     ASLibrary methods
         // Windows specific
         // Linux specific
@@ -40,6 +48,7 @@
     Utf8_16 methods
     }   // end of astyle namespace
     Global Area ---------------------------
+        operator new and delete for allocation stats builds
         Java Native Interface functions
         AStyleMainUtf16 entry point
         AStyleMain entry point
@@ -60,10 +69,17 @@
 #ifdef _WIN32
 	#undef UNICODE		// use ASCII windows functions
 	#include <windows.h>
+	// includes for the batch option binary mode
+	#include <fcntl.h>
+	#include <io.h>
 #else
 	#include <dirent.h>
 	#include <unistd.h>
 	#include <sys/stat.h>
+	// includes for the formatting server
+	#include <signal.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
 	#ifdef __VMS
 		#include <unixlib.h>
 		#include <rms.h>
@@ -84,6 +100,17 @@
 	int _CRT_glob = 0;
 #endif
 
+// the allocation stats build replaces the global operator new and delete
+#ifdef ASTYLE_ALLOC_STATS
+	#ifdef ASTYLE_LIB
+		#error "ASTYLE_ALLOC_STATS is for console builds only"
+	#endif
+	#ifndef __GNUC__
+		#error "ASTYLE_ALLOC_STATS requires the GCC atomic builtins"
+	#endif
+	#include <new>
+#endif
+
 //----------------------------------------------------------------------------
 // astyle namespace
 //----------------------------------------------------------------------------
@@ -128,6 +155,8 @@ ASStreamIterator<T>::ASStreamIterator(T* in)
 	outputEOL[0] = '\0';
 	peekStart = 0;
 	prevLineDeleted = false;
+	bufferLineNumber = 0;
+	prevLineNumber = 0;
 	checkForEmptyLine = false;
 	// get length of stream
 	inStream->seekg(0, inStream->end);
@@ -172,11 +201,15 @@ string ASStreamIterator<T>::nextLine(bool emptyLineWasDeleted)
 		checkForEmptyLine = true;
 	}
 	if (!emptyLineWasDeleted)
+	{
 		prevBuffer = buffer;
+		prevLineNumber = bufferLineNumber;
+	}
 	else
 		prevLineDeleted = true;
 
 	// read the next record
+	bufferLineNumber++;
 	buffer.clear();
 	char ch;
 	inStream->get(ch);
@@ -294,6 +327,7 @@ void ASStreamIterator<T>::saveLastInputLine()
 {
 	assert(inStream->eof());
 	prevBuffer = buffer;
+	prevLineNumber = bufferLineNumber;
 }
 
 // return position of the get pointer
@@ -331,6 +365,324 @@ bool ASStreamIterator<T>::getLineEndChange(int lineEndFormat) const
 	return lineEndChange;
 }
 
+//-----------------------------------------------------------------------------
+// ASRecordIO class
+// length-prefixed records for the formatting server and client
+//-----------------------------------------------------------------------------
+
+#ifndef ASTYLE_LIB
+
+// close the input and output streams
+void ASRecordIO::close()
+{
+	fclose(in);
+	fclose(out);
+}
+
+// flush the output stream
+// return false if an error occurred
+bool ASRecordIO::flush()
+{
+	return (fflush(out) == 0);
+}
+
+/**
+ * Read a length-prefixed field from the input stream.
+ * A field is a decimal byte count and a newline followed by the data.
+ *
+ * @param field     The string to receive the field data.
+ * @return          false at the end of input or if the field is not valid.
+ *                  getIsBadInput() will be true if the field is not valid.
+ */
+bool ASRecordIO::readField(string &field)
+{
+	field.clear();
+	size_t fieldLength = 0;
+	size_t digits = 0;
+	int ch = getc(in);
+	while (ch != EOF && ch != '\n')
+	{
+		// a length of more than 9 digits is not valid
+		if (!isdigit(ch) || ++digits > 9)
+		{
+			isBadInput = true;
+			return false;
+		}
+		fieldLength = (fieldLength * 10) + (ch - '0');
+		ch = getc(in);
+	}
+	// a missing or partial length is not valid
+	if (ch == EOF || digits == 0)
+	{
+		if (ch != EOF || digits > 0)
+			isBadInput = true;
+		return false;
+	}
+	if (fieldLength > 0)
+	{
+		field.resize(fieldLength);
+		if (fread(&field[0], 1, fieldLength, in) != fieldLength)
+		{
+			isBadInput = true;
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Write a length-prefixed field to the output stream.
+ * The stream is not flushed.
+ *
+ * @param field     The field data to be written.
+ * @return          false if an error occurred.
+ */
+bool ASRecordIO::writeField(const string &field)
+{
+	if (fprintf(out, "%lu\n", static_cast<unsigned long>(field.length())) < 0)
+		return false;
+	if (field.length() > 0
+	        && fwrite(field.data(), 1, field.length(), out) != field.length())
+		return false;
+	return true;
+}
+
+#endif	// ASTYLE_LIB
+
+//-----------------------------------------------------------------------------
+// ASWildcard class
+// compiled wildcard for the console build directory search
+//-----------------------------------------------------------------------------
+
+#ifndef ASTYLE_LIB
+
+// compile a wildcard into the text between the '*' characters
+// a '?' matches any character and Windows compares case insensitive
+ASWildcard::ASWildcard(const string &wildcard)
+{
+	string pattern = wildcard;
+	if (!g_isCaseSensitive)
+	{
+		for (size_t i = 0; i < pattern.length(); i++)
+			pattern[i] = (char) tolower(pattern[i]);
+	}
+
+	hasStar = false;
+	minLength = 0;
+	size_t start = 0;
+	size_t star = pattern.find('*');
+	if (star == string::npos)
+	{
+		head = pattern;
+		minLength = head.length();
+		return;
+	}
+	hasStar = true;
+	head = pattern.substr(0, star);
+	while (star != string::npos)
+	{
+		start = star + 1;
+		star = pattern.find('*', start);
+		if (star == string::npos)
+			tail = pattern.substr(start);
+		else if (star > start)
+			middle.push_back(pattern.substr(start, star - start));
+	}
+	minLength = head.length() + tail.length();
+	for (size_t i = 0; i < middle.size(); i++)
+		minLength += middle[i].length();
+}
+
+// check if a file name matches the wildcard
+bool ASWildcard::matches(const char* data) const
+{
+	size_t dataLength = strlen(data);
+	if (dataLength < minLength)
+		return false;
+	if (!hasStar)
+		return (dataLength == head.length() && matchesText(data, head));
+	// the head and tail are anchored, the middle text is the first match
+	if (!matchesText(data, head)
+	        || !matchesText(data + dataLength - tail.length(), tail))
+		return false;
+	const char* cp = data + head.length();
+	const char* end = data + dataLength - tail.length();
+	for (size_t i = 0; i < middle.size(); i++)
+	{
+		while (cp + middle[i].length() <= end && !matchesText(cp, middle[i]))
+			cp++;
+		if (cp + middle[i].length() > end)
+			return false;
+		cp += middle[i].length();
+	}
+	return true;
+}
+
+// check if the text matches the data at the start of the data
+// a '?' in the text matches any character
+bool ASWildcard::matchesText(const char* data, const string &text) const
+{
+	for (size_t i = 0; i < text.length(); i++)
+	{
+		if (text[i] == '?')
+			continue;
+		char ch = g_isCaseSensitive ? data[i] : (char) tolower(data[i]);
+		if (ch != text[i])
+			return false;
+	}
+	return true;
+}
+
+#endif	// ASTYLE_LIB
+
+//-----------------------------------------------------------------------------
+// ASIgnoreRules class
+// ignore file patterns for the console build directory search
+//-----------------------------------------------------------------------------
+
+#ifndef ASTYLE_LIB
+
+// check if a file or directory is ignored by the rules of this and the parent directories
+// the last matching rule of the nearest ignore file is used
+bool ASIgnoreRules::isIgnored(const string &path, bool isDirectory) const
+{
+	for (const ASIgnoreRules* level = this; level != NULL; level = level->parent)
+	{
+		if (path.length() <= level->directory.length())
+			continue;
+		const char* relativePath = path.c_str() + level->directory.length() + 1;
+		const char* name = path.c_str() + path.find_last_of(g_fileSeparator) + 1;
+		for (size_t i = level->rules.size(); i-- > 0;)
+		{
+			const IgnoreRule &rule = level->rules[i];
+			if (rule.isDirOnly && !isDirectory)
+				continue;
+			if (matchesPattern(rule.pattern.c_str(), rule.isAnchored ? relativePath : name))
+				return !rule.isNegated;
+		}
+	}
+	return false;
+}
+
+// match a pattern to a file name or relative path
+// a '*' or '?' does not match a separator, a "**" matches any number of directories
+bool ASIgnoreRules::matchesPattern(const char* pattern, const char* data) const
+{
+	for (; *pattern != '\0'; pattern++, data++)
+	{
+		if (*pattern == '*')
+		{
+			if (pattern[1] == '*')
+			{
+				pattern += 2;
+				// a "**/" matches at the start of a directory name
+				bool isDirectoryStart = (*pattern == '/');
+				if (isDirectoryStart)
+					pattern++;
+				for (;; data++)
+				{
+					if (matchesPattern(pattern, data))
+						return true;
+					if (*data == '\0')
+						return false;
+					if (isDirectoryStart)
+					{
+						while (*data != '\0' && *data != '/' && *data != g_fileSeparator)
+							data++;
+						if (*data == '\0')
+							return false;
+					}
+				}
+			}
+			pattern++;
+			for (;; data++)
+			{
+				if (matchesPattern(pattern, data))
+					return true;
+				if (*data == '\0' || *data == '/' || *data == g_fileSeparator)
+					return false;
+			}
+		}
+		if (*data == '\0')
+			return false;
+		if (*pattern == '/')
+		{
+			if (*data != '/' && *data != g_fileSeparator)
+				return false;
+			continue;
+		}
+		if (*pattern == '?')
+		{
+			if (*data == '/' || *data == g_fileSeparator)
+				return false;
+			continue;
+		}
+		if (*pattern == '\\' && pattern[1] != '\0')
+			pattern++;
+		if (g_isCaseSensitive ? *pattern != *data : tolower(*pattern) != tolower(*data))
+			return false;
+	}
+	return (*data == '\0');
+}
+
+// read the ignore file of a directory and compile the patterns
+// the parent rules are used for the patterns not matched by this file
+// return true if the file has a pattern
+bool ASIgnoreRules::readIgnoreFile(const string &directoryArg, const string &fileName,
+                                   const ASIgnoreRules* parentArg)
+{
+	parent = parentArg;
+	directory = directoryArg;
+	rules.clear();
+	ifstream fin((directory + g_fileSeparator + fileName).c_str());
+	if (!fin)
+		return false;
+
+	string line;
+	while (getline(fin, line))
+	{
+		// remove trailing white space that is not escaped
+		size_t end = line.find_last_not_of(" \t\r");
+		if (end == string::npos)
+			continue;
+		if (end + 1 < line.length() && line[end] == '\\')
+			end++;
+		line.erase(end + 1);
+		if (line[0] == '#')
+			continue;
+
+		IgnoreRule rule;
+		rule.isNegated = false;
+		rule.isDirOnly = false;
+		rule.isAnchored = false;
+		size_t start = 0;
+		if (line[0] == '!')
+		{
+			rule.isNegated = true;
+			start = 1;
+		}
+		else if (line[0] == '\\' && line.length() > 1 && (line[1] == '#' || line[1] == '!'))
+			start = 1;
+		if (line.length() > start + 1 && line[line.length() - 1] == '/')
+		{
+			rule.isDirOnly = true;
+			line.erase(line.length() - 1);
+		}
+		// a separator at the start or in the middle anchors the pattern to this directory
+		if (line.find('/', start) != string::npos)
+			rule.isAnchored = true;
+		if (start < line.length() && line[start] == '/')
+			start++;
+		rule.pattern = line.substr(start);
+		if (rule.pattern.empty())
+			continue;
+		rules.push_back(rule);
+	}
+	return !rules.empty();
+}
+
+#endif	// ASTYLE_LIB
+
 //-----------------------------------------------------------------------------
 // ASConsole class
 // main function will be included only in the console build
@@ -338,6 +690,79 @@ bool ASStreamIterator<T>::getLineEndChange(int lineEndFormat) const
 
 #ifndef ASTYLE_LIB
 
+/**
+ * Check the exclude hits vector for unprocessed excludes and display them.
+ *
+ * @return              true if an unmatched exclude is an error.
+ */
+bool ASConsole::checkExcludeHits() const
+{
+	bool excludeErr = false;
+	for (size_t ix = 0; ix < excludeHitsVector.size(); ix++)
+	{
+		if (excludeHitsVector[ix] == false)
+		{
+			excludeErr = true;
+			if (!ignoreExcludeErrorsDisplay)
+			{
+				if (ignoreExcludeErrors)
+					printMsg(_("Exclude (unmatched)  %s\n"), excludeVector[ix]);
+				else
+					fprintf(stderr, _("Exclude (unmatched)  %s\n"), excludeVector[ix].c_str());
+			}
+			else
+			{
+				if (!ignoreExcludeErrors)
+					fprintf(stderr, _("Exclude (unmatched)  %s\n"), excludeVector[ix].c_str());
+			}
+		}
+	}
+	return (excludeErr && !ignoreExcludeErrors);
+}
+
+/**
+ * Check that a file is formatted for the check option.
+ * Formatting stops at the first output line that differs from the input.
+ * The output is not saved and the file is not written.
+ *
+ * @param fileName_     The path and name of the file to be checked.
+ */
+void ASConsole::checkFile(const string &fileName_)
+{
+	stringstream in;
+	ostringstream out;
+	readFile(fileName_, in);
+	setLanguageMode(fileName_);
+	int diffLine = 0;
+	bool isFormatted = formatStream(in, out, &diffLine);
+
+	// remove targetDirectory from filename if required by print
+	string displayName;
+	if (hasWildcard)
+		displayName = fileName_.substr(targetDirectory.length() + 1);
+	else
+		displayName = fileName_;
+
+	if (isFormatted)
+	{
+		// the line is not known if only the line ends differ
+		if (diffLine != 0)
+		{
+			ostringstream lineStr;
+			lineStr << diffLine;
+			displayName += ":" + lineStr.str();
+		}
+		printMsg(_("Not formatted  %s\n"), displayName);
+		filesFormatted++;
+	}
+	else
+	{
+		if (!isFormattedOnly)
+			printMsg(_("Unchanged  %s\n"), displayName);
+		filesUnchanged++;
+	}
+}
+
 // rewrite a stringstream converting the line ends
 void ASConsole::convertLineEnds(ostringstream &out, int lineEnd)
 {
@@ -434,6 +859,14 @@ void ASConsole::correctMixedLineEnds(ostringstream &out)
 	convertLineEnds(out, lineEndFormat);
 }
 
+// delete a console created by newRequestConsole and its formatter
+void ASConsole::deleteRequestConsole(ASConsole* requestConsole)
+{
+	ASFormatter* requestFormatter = &requestConsole->formatter;
+	delete requestConsole;
+	delete requestFormatter;
+}
+
 // check files for 16 or 32 bit encoding
 // the file must have a Byte Order Mark (BOM)
 // NOTE: some string functions don't work with NULLs (e.g. length())
@@ -467,14 +900,165 @@ void ASConsole::error(const char* why, const char* what) const
 	error();
 }
 
+// error in a file function
+// the message is returned in errorMsg if it is not NULL, otherwise this is an error exit
+// a server request uses errorMsg so one bad file does not stop the server
+void ASConsole::fileError(const char* why, const char* what, string* errorMsg) const
+{
+	if (errorMsg == NULL)
+		error(why, what);
+	*errorMsg = string(why) + ' ' + what;
+}
+
+// find the exclude that matches a path
+// the exclude trie is matched in one pass from the end of the path
+// the exclude hits vector is not updated
+// return the index in the exclude vector, or -1 if no match
+int ASConsole::findExclude(const string &subPath) const
+{
+	if (excludeTrie.empty())
+		return -1;
+
+	int excludeIndex = -1;
+	int node = 0;
+	size_t compareStart = subPath.length();
+	while (true)
+	{
+		// an exclude must match from the start of a directory name
+		// if more than one matches use the first in the exclude vector
+		int nodeIndex = excludeTrie[node].excludeIndex;
+		if (nodeIndex >= 0
+		        && (excludeIndex < 0 || nodeIndex < excludeIndex)
+		        && (compareStart == 0 || subPath[compareStart - 1] == g_fileSeparator))
+			excludeIndex = nodeIndex;
+		if (compareStart == 0)
+			break;
+
+		char ch = subPath[--compareStart];
+		// make it case insensitive for Windows
+		if (!g_isCaseSensitive)
+			ch = (char)tolower(ch);
+		int child = excludeTrie[node].firstChild;
+		while (child >= 0 && excludeTrie[child].ch != ch)
+			child = excludeTrie[child].nextSibling;
+		if (child < 0)
+			break;
+		node = child;
+	}
+	return excludeIndex;
+}
+
+/**
+ * Format a stream of records from stdin to stdout for the batch option.
+ * A request has the fields name, options, and content.
+ * The name is used to determine the language mode.
+ * The options are added to the command line options and may be empty.
+ * The reply has the fields status and text, in the order of the requests.
+ * The status is "formatted", "unchanged", or "error" with an error message.
+ * The formatters are reused for each set of options until the end of input.
+ */
+void ASConsole::formatBatch()
+{
+#ifdef _WIN32
+	// the records are binary data
+	_setmode(_fileno(stdin), _O_BINARY);
+	_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	ASRecordIO recordIO(stdin, stdout);
+	map<string, ASConsole*> requestConsoles;
+	string name;
+	string options;
+	string content;
+
+	while (recordIO.readField(name))
+	{
+		if (!recordIO.readField(options) || !recordIO.readField(content))
+			error("Invalid batch input for", name.c_str());
+
+		string status = "error";
+		string text;
+		ASConsole* requestConsole = this;
+		if (!options.empty())
+		{
+			map<string, ASConsole*>::iterator it = requestConsoles.find(options);
+			if (it != requestConsoles.end())
+				requestConsole = it->second;
+			else
+			{
+				requestConsole = newRequestConsole(getRequestOptions() + options, text);
+				if (requestConsole != NULL)
+					requestConsoles[options] = requestConsole;
+			}
+		}
+		if (requestConsole != NULL)
+		{
+			stringstream in(content);
+			ostringstream out;
+			requestConsole->setLanguageMode(name);
+			bool isFormatted = requestConsole->formatStream(in, out);
+			status = isFormatted ? "formatted" : "unchanged";
+			text = out.str();
+		}
+		if (!recordIO.writeField(status)
+		        || !recordIO.writeField(text)
+		        || !recordIO.flush())
+			error("Cannot write batch output for", name.c_str());
+	}
+	if (recordIO.getIsBadInput())
+		error("Invalid batch input after", name.c_str());
+
+	map<string, ASConsole*>::iterator it;
+	for (it = requestConsoles.begin(); it != requestConsoles.end(); ++it)
+		deleteRequestConsole(it->second);
+}
+
 /**
  * If no files have been given, use cin for input and cout for output.
  *
  * This is used to format text for text editors like TextWrangler (Mac).
  * Do NOT display any console messages when this function is used.
+ * The check option displays only the check result and does not output the text.
  */
 void ASConsole::formatCinToCout()
 {
+	// check the input without formatting all of it
+	if (isCheck)
+	{
+		stringstream in;
+		char ch;
+		cin.get(ch);
+		while (!cin.eof())
+		{
+			in.put(ch);
+			cin.get(ch);
+		}
+		ostringstream out;
+		int diffLine = 0;
+		if (formatStream(in, out, &diffLine))
+		{
+			// the line is not known if only the line ends differ
+			string displayName = "<stdin>";
+			if (diffLine != 0)
+			{
+				ostringstream lineStr;
+				lineStr << diffLine;
+				displayName += ":" + lineStr.str();
+			}
+			printMsg(_("Not formatted  %s\n"), displayName);
+			filesFormatted++;
+		}
+		return;
+	}
+
+#ifndef _WIN32
+	// send the text to a formatting server
+	if (!clientSocket.empty())
+	{
+		formatCinToCoutWithServer();
+		return;
+	}
+#endif
+
 	// Using cin.tellg() causes problems with both Windows and Linux.
 	// The Windows problem occurs when the input is not Windows line-ends.
 	// The tellg() will be out of sequence with the get() statements.
@@ -526,33 +1110,118 @@ void ASConsole::formatCinToCout()
  */
 void ASConsole::formatFile(const string &fileName_)
 {
+	// check the file without formatting all of it
+	if (isCheck)
+	{
+		checkFile(fileName_);
+		return;
+	}
+
+#ifndef _WIN32
+	// send the file to a formatting server
+	if (!clientSocket.empty())
+	{
+		formatFileWithServer(fileName_);
+		return;
+	}
+#endif
+
 	stringstream in;
 	ostringstream out;
-	FileEncoding encoding = readFile(fileName_, in);
-
-	// Unless a specific language mode has been set, set the language mode
-	// according to the file's suffix.
-	if (!formatter.getModeManuallySet())
+	ASProfiler::PhaseStats startStats[ASProfiler::PHASE_COUNT];
+	ASProfiler::AllocStats startAllocStats;
+	int startLinesOut = linesOut;
+	if (isProfile)
 	{
-		if (stringEndsWith(fileName_, string(".java")))
-			formatter.setJavaStyle();
-		else if (stringEndsWith(fileName_, string(".cs")))
-			formatter.setSharpStyle();
-		else
-			formatter.setCStyle();
+		ASProfiler::getPhaseStats(startStats);
+		ASProfiler::getThreadAllocStats(&startAllocStats);
 	}
+	double startTime = ASProfiler::getTime();
+	FileEncoding encoding = readFile(fileName_, in);
+	double readEndTime = ASProfiler::getTime();
+	streamoff inputSize = in.tellp();
 
-	// set line end format
-	string nextLine;				// next output line
-	filesAreIdentical = true;		// input and output files are identical
-	LineEndFormat lineEndFormat = formatter.getLineEndFormat();
+	setLanguageMode(fileName_);
+	bool isFormatted = formatStream(in, out);
+	double formatEndTime = ASProfiler::getTime();
+
+	// remove targetDirectory from filename if required by print
+	string displayName;
+	if (hasWildcard)
+		displayName = fileName_.substr(targetDirectory.length() + 1);
+	else
+		displayName = fileName_;
+
+	// if file has changed, write the new file
+	double writeEndTime = formatEndTime;
+	if (isFormatted)
+	{
+		if (!isDryRun)
+		{
+			writeFile(fileName_, encoding, out);
+			writeEndTime = ASProfiler::getTime();
+			bytesWritten += static_cast<double>(out.tellp());
+		}
+		printMsg(_("Formatted  %s\n"), displayName);
+		filesFormatted++;
+	}
+	else
+	{
+		if (!isFormattedOnly)
+			printMsg(_("Unchanged  %s\n"), displayName);
+		filesUnchanged++;
+	}
+
+	// accumulate the wall clock times for the verbose stats
+	if (isVerbose)
+	{
+		bytesRead += static_cast<double>(inputSize);
+		readTime += readEndTime - startTime;
+		formatTime += formatEndTime - readEndTime;
+		writeTime += writeEndTime - formatEndTime;
+		updateSlowestFiles(displayName, writeEndTime - startTime);
+	}
+	if (isProfile)
+		printProfileFile(startStats, startAllocStats, linesOut - startLinesOut, startTime);
+	// the format span includes comparing the output to the input
+	if (ASProfiler::getIsTracing())
+	{
+		ASProfiler::addTraceEvent("file", displayName, 0, startTime, writeEndTime);
+		ASProfiler::addTraceEvent("read", string(), 0, startTime, readEndTime);
+		ASProfiler::addTraceEvent("format", string(), 0, readEndTime, formatEndTime);
+		if (writeEndTime > formatEndTime)
+			ASProfiler::addTraceEvent("write", string(), 0, formatEndTime, writeEndTime);
+	}
+
+	assert(formatter.getChecksumDiff() == 0);
+}
+
+/**
+ * Format an input stream to an output stream.
+ * The language mode must be set before this is called.
+ * This is used by formatFile and checkFile and by the server and batch requests.
+ *
+ * @param in            The input stream to be formatted.
+ * @param out           The stream to receive the formatted output.
+ * @param diffLine      If it is not NULL, formatting stops at the first line that
+ *                      differs and it receives the input line number, or 0.
+ * @return              true if the output differs from the input.
+ */
+bool ASConsole::formatStream(stringstream &in, ostringstream &out, int* diffLine /*NULL*/)
+{
+	// set line end format
+	string nextLine;				// next output line
+	filesAreIdentical = true;		// input and output files are identical
+	LineEndFormat lineEndFormat = formatter.getLineEndFormat();
 	initializeOutputEOL(lineEndFormat);
 	// do this AFTER setting the file mode
 	ASStreamIterator<stringstream> streamIterator(&in);
 	formatter.init(&streamIterator);
+	if (diffLine != NULL)
+		*diffLine = 0;
 
-	// format the file
-	while (formatter.hasMoreLines())
+	// format the file, or until a line differs for the check option
+	while (formatter.hasMoreLines() && (diffLine == NULL || filesAreIdentical))
 	{
 		nextLine = formatter.nextLine();
 		out << nextLine;
@@ -587,6 +1256,8 @@ void ASConsole::formatFile(const string &fileName_)
 			else if (!streamIterator.compareToInputBuffer(nextLine))
 				filesAreIdentical = false;
 			streamIterator.checkForEmptyLine = false;
+			if (!filesAreIdentical && diffLine != NULL)
+				*diffLine = streamIterator.getPrevLineNumber();
 		}
 	}
 	// correct for mixed line ends
@@ -596,29 +1267,7 @@ void ASConsole::formatFile(const string &fileName_)
 		filesAreIdentical = false;
 	}
 
-	// remove targetDirectory from filename if required by print
-	string displayName;
-	if (hasWildcard)
-		displayName = fileName_.substr(targetDirectory.length() + 1);
-	else
-		displayName = fileName_;
-
-	// if file has changed, write the new file
-	if (!filesAreIdentical || streamIterator.getLineEndChange(lineEndFormat))
-	{
-		if (!isDryRun)
-			writeFile(fileName_, encoding, out);
-		printMsg(_("Formatted  %s\n"), displayName);
-		filesFormatted++;
-	}
-	else
-	{
-		if (!isFormattedOnly)
-			printMsg(_("Unchanged  %s\n"), displayName);
-		filesUnchanged++;
-	}
-
-	assert(formatter.getChecksumDiff() == 0);
+	return (!filesAreIdentical || streamIterator.getLineEndChange(lineEndFormat));
 }
 
 // build a vector of argv options
@@ -657,6 +1306,13 @@ vector<string> ASConsole::getFileOptionsVector() const
 bool ASConsole::getFilesAreIdentical() const
 { return filesAreIdentical; }
 
+// for unit testing
+string ASConsole::getFilesFromName() const
+{ return filesFromName; }
+
+string ASConsole::getIgnoreFileName() const
+{ return ignoreFileName; }
+
 // for unit testing
 int ASConsole::getFilesFormatted() const
 { return filesFormatted; }
@@ -669,10 +1325,21 @@ bool ASConsole::getIgnoreExcludeErrors() const
 bool ASConsole::getIgnoreExcludeErrorsDisplay() const
 { return ignoreExcludeErrorsDisplay; }
 
+// for unit testing
+bool ASConsole::getIsBatch() const
+{ return isBatch; }
+
+// for unit testing
+bool ASConsole::getIsCheck() const
+{ return isCheck; }
+
 // for unit testing
 bool ASConsole::getIsDryRun() const
 { return isDryRun; }
 
+bool ASConsole::getIsProfile() const
+{ return isProfile; }
+
 // for unit testing
 bool ASConsole::getIsFormattedOnly() const
 { return isFormattedOnly; }
@@ -717,6 +1384,10 @@ string ASConsole::getOrigSuffix() const
 bool ASConsole::getPreserveDate() const
 { return preserveDate; }
 
+// for unit testing
+string ASConsole::getServerSocket() const
+{ return serverSocket; }
+
 // for unit testing
 void ASConsole::setBypassBrowserOpen(bool state)
 { bypassBrowserOpen = state; }
@@ -726,6 +1397,43 @@ string ASConsole::getParam(const string &arg, const char* op)
 	return arg.substr(strlen(op));
 }
 
+/**
+ * Get the options to be used by a request console.
+ * The options file options are followed by the command line options.
+ * The options for the whole process, such as verbose, are not included.
+ * The options are also the fingerprint of a formatter in the server.
+ *
+ * @return              The options separated by new-lines.
+ */
+string ASConsole::getRequestOptions() const
+{
+	return requestOptions;
+}
+
+// escape a string for a JSON string value
+string ASConsole::getJsonString(const string &text) const
+{
+	string json;
+	for (size_t i = 0; i < text.length(); i++)
+	{
+		unsigned char ch = static_cast<unsigned char>(text[i]);
+		if (ch == '"' || ch == '\\')
+		{
+			json += '\\';
+			json += text[i];
+		}
+		else if (ch < 0x20)
+		{
+			char hex[8];
+			sprintf(hex, "\\u%04x", ch);
+			json += hex;
+		}
+		else
+			json += text[i];
+	}
+	return json;
+}
+
 // initialize output end of line
 void ASConsole::initializeOutputEOL(LineEndFormat lineEndFormat)
 {
@@ -748,22 +1456,42 @@ void ASConsole::initializeOutputEOL(LineEndFormat lineEndFormat)
 		outputEOL[0] = '\0';
 }
 
-FileEncoding ASConsole::readFile(const string &fileName_, stringstream &in) const
+/**
+ * Read a file and convert utf-16 to utf-8.
+ *
+ * @param fileName_     The path and name of the file to be read.
+ * @param in            Receives the file text.
+ * @param errorMsg      Receives an error instead of an error exit if it is not NULL.
+ * @return              The encoding of the file.
+ */
+FileEncoding ASConsole::readFile(const string &fileName_, stringstream &in, string* errorMsg) const
 {
+	ASProfileTimer timer(ASProfiler::READ_PHASE);
 	const int blockSize = 65536;	// 64 KB
 	ifstream fin(fileName_.c_str(), ios::binary);
 	if (!fin)
-		error("Cannot open input file", fileName_.c_str());
+	{
+		fileError("Cannot open input file", fileName_.c_str(), errorMsg);
+		return ENCODING_8BIT;
+	}
 	char* data = new(nothrow) char[blockSize];
 	if (!data)
-		error("Cannot allocate memory for input file", fileName_.c_str());
+	{
+		fileError("Cannot allocate memory for input file", fileName_.c_str(), errorMsg);
+		return ENCODING_8BIT;
+	}
 	fin.read(data, blockSize);
-	if (fin.bad())
-		error("Cannot read input file", fileName_.c_str());
 	size_t dataSize = static_cast<size_t>(fin.gcount());
 	FileEncoding encoding = detectEncoding(data, dataSize);
-	if (encoding ==  UTF_32BE || encoding ==  UTF_32LE)
-		error(_("Cannot process UTF-32 encoding"), fileName_.c_str());
+	if (fin.bad())
+		fileError("Cannot read input file", fileName_.c_str(), errorMsg);
+	else if (encoding ==  UTF_32BE || encoding ==  UTF_32LE)
+		fileError(_("Cannot process UTF-32 encoding"), fileName_.c_str(), errorMsg);
+	if (fin.bad() || encoding ==  UTF_32BE || encoding ==  UTF_32LE)
+	{
+		delete [] data;
+		return encoding;
+	}
 	bool firstBlock = true;
 	bool isBigEndian = (encoding == UTF_16BE);
 	while (dataSize)
@@ -774,7 +1502,10 @@ FileEncoding ASConsole::readFile(const string &fileName_, stringstream &in) cons
 			size_t utf8Size = utf8_16.Utf8LengthFromUtf16(data, dataSize, isBigEndian);
 			char* utf8Out = new(nothrow) char[utf8Size];
 			if (!utf8Out)
-				error("Cannot allocate memory for utf-8 conversion", fileName_.c_str());
+			{
+				fileError("Cannot allocate memory for utf-8 conversion", fileName_.c_str(), errorMsg);
+				break;
+			}
 			size_t utf8Len = utf8_16.Utf16ToUtf8(data, dataSize, isBigEndian, firstBlock, utf8Out);
 			assert(utf8Len == utf8Size);
 			in << string(utf8Out, utf8Len);
@@ -784,7 +1515,10 @@ FileEncoding ASConsole::readFile(const string &fileName_, stringstream &in) cons
 			in << string(data, dataSize);
 		fin.read(data, blockSize);
 		if (fin.bad())
-			error("Cannot read input file", fileName_.c_str());
+		{
+			fileError("Cannot read input file", fileName_.c_str(), errorMsg);
+			break;
+		}
 		dataSize = static_cast<size_t>(fin.gcount());
 		firstBlock = false;
 	}
@@ -799,6 +1533,9 @@ void ASConsole::setIgnoreExcludeErrors(bool state)
 void ASConsole::setIgnoreExcludeErrorsAndDisplay(bool state)
 { ignoreExcludeErrors = state; ignoreExcludeErrorsDisplay = state; }
 
+void ASConsole::setIgnoreFileName(const string &name)
+{ ignoreFileName = name; }
+
 void ASConsole::setIsFormattedOnly(bool state)
 { isFormattedOnly = state; }
 
@@ -811,6 +1548,12 @@ void ASConsole::setIsRecursive(bool state)
 void ASConsole::setIsDryRun(bool state)
 { isDryRun = state; }
 
+void ASConsole::setIsProfile(bool state)
+{ isProfile = state; }
+
+void ASConsole::setTraceFileName(const string &name)
+{ traceFileName = name; }
+
 void ASConsole::setIsVerbose(bool state)
 { isVerbose = state; }
 
@@ -826,6 +1569,20 @@ void ASConsole::setOrigSuffix(string suffix)
 void ASConsole::setPreserveDate(bool state)
 { preserveDate = state; }
 
+// Unless a specific language mode has been set, set the language mode
+// according to the file's suffix.
+void ASConsole::setLanguageMode(const string &fileName_)
+{
+	if (formatter.getModeManuallySet())
+		return;
+	if (stringEndsWith(fileName_, string(".java")))
+		formatter.setJavaStyle();
+	else if (stringEndsWith(fileName_, string(".cs")))
+		formatter.setSharpStyle();
+	else
+		formatter.setCStyle();
+}
+
 // set outputEOL variable
 void ASConsole::setOutputEOL(LineEndFormat lineEndFormat, const char* currentEOL)
 {
@@ -892,14 +1649,22 @@ string ASConsole::getCurrentDirectory(const string &fileName_) const
  * WINDOWS function to resolve wildcards and recurse into sub directories.
  * The fileName vector is filled with the path and names of files to process.
  *
+ * The files are matched to the wildcards of the current search.
+ *
  * @param directory     The path of the directory to be processed.
- * @param wildcard      The wildcard to be processed (e.g. *.cpp).
  */
-void ASConsole::getFileNames(const string &directory, const string &wildcard)
+void ASConsole::getFileNames(const string &directory)
 {
 	vector<string> subDirectory;    // sub directories of directory
 	WIN32_FIND_DATA findFileData;   // for FindFirstFile and FindNextFile
 
+	// read the ignore file, the rules are used for the sub directories
+	const ASIgnoreRules* parentIgnoreRules = ignoreRules;
+	ASIgnoreRules directoryIgnoreRules;
+	if (!ignoreFileName.empty()
+	        && directoryIgnoreRules.readIgnoreFile(directory, ignoreFileName, ignoreRules))
+		ignoreRules = &directoryIgnoreRules;
+
 	// Find the first file in the directory
 	// Find will get at least "." and "..".
 	string firstFile = directory + "\\*";
@@ -932,17 +1697,19 @@ void ASConsole::getFileNames(const string &directory, const string &wildcard)
 			string subDirectoryPath = directory + g_fileSeparator + findFileData.cFileName;
 			if (isPathExclued(subDirectoryPath))
 				printMsg(_("Exclude  %s\n"), subDirectoryPath.substr(mainDirectoryLength));
-			else
+			else if (ignoreRules == NULL || !ignoreRules->isIgnored(subDirectoryPath, true))
 				subDirectory.push_back(subDirectoryPath);
 			continue;
 		}
 
 		// save the file name
 		string filePathName = directory + g_fileSeparator + findFileData.cFileName;
-		// check exclude before wildcmp to avoid "unmatched exclude" error
+		// check exclude before the wildcards to avoid "unmatched exclude" error
 		bool isExcluded = isPathExclued(filePathName);
+		if (!isExcluded && ignoreRules != NULL && ignoreRules->isIgnored(filePathName, false))
+			continue;
 		// save file name if wildcard match
-		if (wildcmp(wildcard.c_str(), findFileData.cFileName))
+		if (matchesWildcard(findFileData.cFileName, isExcluded ? NULL : &wildcardHitsVector))
 		{
 			if (isExcluded)
 				printMsg(_("Exclude  %s\n"), filePathName.substr(mainDirectoryLength));
@@ -961,8 +1728,9 @@ void ASConsole::getFileNames(const string &directory, const string &wildcard)
 	// recurse into sub directories
 	// if not doing recursive subDirectory is empty
 	for (unsigned i = 0; i < subDirectory.size(); i++)
-		getFileNames(subDirectory[i], wildcard);
+		getFileNames(subDirectory[i]);
 
+	ignoreRules = parentIgnoreRules;
 	return;
 }
 
@@ -1076,108 +1844,222 @@ void ASConsole::launchDefaultBrowser(const char* filePathIn /*NULL*/) const
 #else  // Linux specific
 
 /**
- * LINUX function to get the current directory.
- * This is done if the fileName does not contain a path.
- * It is probably from an editor sending a single file.
- *
- * @param fileName_     The filename is used only for  the error message.
- * @return              The path of the current directory
+ * LINUX function to connect to the formatting server from the client= option.
+ * The connection is kept open for all of the files processed.
  */
-string ASConsole::getCurrentDirectory(const string &fileName_) const
+void ASConsole::connectToServer()
 {
-	char* currdir = getenv("PWD");
-	if (currdir == NULL)
-		error("Cannot find file", fileName_.c_str());
-	return string(currdir);
+	struct sockaddr_un address;
+	if (clientSocket.length() >= sizeof(address.sun_path))
+		error("Socket path is too long", clientSocket.c_str());
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, clientSocket.c_str());
+
+	int serverFd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (serverFd < 0
+	        || connect(serverFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		perror("errno message");
+		error("Cannot connect to server", clientSocket.c_str());
+	}
+	FILE* serverIn = fdopen(serverFd, "rb");
+	FILE* serverOut = fdopen(dup(serverFd), "wb");
+	if (serverIn == NULL || serverOut == NULL)
+		error("Cannot connect to server", clientSocket.c_str());
+	serverIO = new ASRecordIO(serverIn, serverOut);
 }
 
 /**
- * LINUX function to resolve wildcards and recurse into sub directories.
- * The fileName vector is filled with the path and names of files to process.
+ * LINUX function to format cin to cout using the formatting server.
+ * The language mode is determined by the server options.
+ */
+void ASConsole::formatCinToCoutWithServer()
+{
+	string text;
+	char ch;
+	cin.get(ch);
+	while (!cin.eof())
+	{
+		text.append(1, ch);
+		cin.get(ch);
+	}
+	string status;
+	string reply;
+	if (!requestFromServer("text", "<stdin>", text, status, reply))
+		error("Server error", reply.c_str());
+	cout << reply;
+	cout.flush();
+}
+
+/**
+ * LINUX function to format the files in a directory for the wildcard and recursive options.
+ * The directories are searched by an ASDirectoryWalker thread pool and the
+ * files are formatted as they are found, in sorted order by directory.
+ * The excluded entries are displayed in sorted order with their directory.
+ *
+ * An unmatched exclude must stop the run before any file is formatted.
+ * Until every exclude has been matched the files found are added to the
+ * fileName vector instead. They are formatted when the last exclude is
+ * matched, or by processFiles after getFilePaths has checked the excludes.
+ *
+ * The files are matched to the wildcards of the current search.
  *
  * @param directory     The path of the directory to be processed.
- * @param wildcard      The wildcard to be processed (e.g. *.cpp).
  */
-void ASConsole::getFileNames(const string &directory, const string &wildcard)
+void ASConsole::formatDirectoryTree(const string &directory)
 {
-	struct dirent* entry;           // entry from readdir()
-	struct stat statbuf;            // entry from stat()
-	vector<string> subDirectory;    // sub directories of this directory
-
-	// errno is defined in <errno.h> and is set for errors in opendir, readdir, or stat
-	errno = 0;
-
-	DIR* dp = opendir(directory.c_str());
-	if (dp == NULL)
-		error(_("Cannot open directory"), directory.c_str());
+	typedef ASDirectoryWalker::WalkDirectory WalkDirectory;
+	ASDirectoryWalker walker(*this);
+	vector<WalkDirectory*> dirStack;
+	dirStack.push_back(walker.start(directory));
+	bool isExcludeCheckPending = (!ignoreExcludeErrors && !excludeHitsVector.empty());
 
-	// save the first fileName entry for this recursion
-	const unsigned firstEntry = fileName.size();
-
-	// save files and sub directories
-	while ((entry = readdir(dp)) != NULL)
+	while (!dirStack.empty())
 	{
-		// get file status
-		string entryFilepath = directory + g_fileSeparator + entry->d_name;
-		if (stat(entryFilepath.c_str(), &statbuf) != 0)
+		WalkDirectory* dir = dirStack.back();
+		if (!dir->isProcessed)
 		{
-			if (errno == EOVERFLOW)         // file over 2 GB is OK
+			walker.waitForDirectory(dir);
+			if (dir->errorMsg != NULL)
 			{
-				errno = 0;
-				continue;
+				if (dir->errorNumber != 0)
+				{
+					errno = dir->errorNumber;
+					perror("errno message");
+				}
+				error(_(dir->errorMsg), dir->path.c_str());
 			}
-			perror("errno message");
-			error("Error getting file status in directory", directory.c_str());
-		}
-		// skip hidden or read only
-		if (entry->d_name[0] == '.' || !(statbuf.st_mode & S_IWUSR))
-			continue;
-		// if a sub directory and recursive, save sub directory
-		if (S_ISDIR(statbuf.st_mode) && isRecursive)
-		{
-			if (isPathExclued(entryFilepath))
-				printMsg(_("Exclude  %s\n"), entryFilepath.substr(mainDirectoryLength));
+			dirsOpened += dir->dirsOpened;
+			statCalls += dir->statCalls;
+			if (ASProfiler::getIsTracing())
+				ASProfiler::addTraceEvent("search", dir->path, dir->searchThread,
+				                          dir->searchStartTime, dir->searchEndTime);
+			for (size_t i = 0; i < dir->excludeHits.size(); i++)
+				excludeHitsVector[dir->excludeHits[i]] = true;
+			for (size_t i = 0; i < dir->wildcardHits.size(); i++)
+				if (dir->wildcardHits[i])
+					wildcardHitsVector[i] = true;
+			for (size_t i = 0; i < dir->excluded.size(); i++)
+				printMsg(_("Exclude  %s\n"), dir->excluded[i].substr(mainDirectoryLength));
+			// format the files saved while an exclude was not matched
+			if (isExcludeCheckPending
+			        && find(excludeHitsVector.begin(), excludeHitsVector.end(), false) == excludeHitsVector.end())
+			{
+				isExcludeCheckPending = false;
+				for (size_t i = 0; i < fileName.size() && !isFailFastStop(); i++)
+					formatFile(fileName[i]);
+				fileName.clear();
+			}
+			if (isExcludeCheckPending)
+				fileName.insert(fileName.end(), dir->files.begin(), dir->files.end());
 			else
-				subDirectory.push_back(entryFilepath);
-			continue;
-		}
-
-		// if a file, save file name
-		if (S_ISREG(statbuf.st_mode))
-		{
-			// check exclude before wildcmp to avoid "unmatched exclude" error
-			bool isExcluded = isPathExclued(entryFilepath);
-			// save file name if wildcard match
-			if (wildcmp(wildcard.c_str(), entry->d_name))
 			{
-				if (isExcluded)
-					printMsg(_("Exclude  %s\n"), entryFilepath.substr(mainDirectoryLength));
-				else
-					fileName.push_back(entryFilepath);
+				for (size_t i = 0; i < dir->files.size() && !isFailFastStop(); i++)
+					formatFile(dir->files[i]);
 			}
+			dir->isProcessed = true;
+			walker.releaseDirectory(dir);
+		}
+		// process the sub directories, then delete the directory
+		if (dir->nextSubDirectory < dir->subDirectories.size())
+			dirStack.push_back(dir->subDirectories[dir->nextSubDirectory++]);
+		else
+		{
+			dirStack.pop_back();
+			delete dir;
 		}
 	}
+}
 
-	if (closedir(dp) != 0)
-	{
-		perror("errno message");
-		error("Error reading directory", directory.c_str());
-	}
+/**
+ * LINUX function to format a file using the formatting server.
+ * The server reads and writes the file.
+ *
+ * @param fileName_     The path and name of the file to be processed.
+ */
+void ASConsole::formatFileWithServer(const string &fileName_)
+{
+	// the server needs the complete path
+	string filePath = fileName_;
+	if (filePath[0] != g_fileSeparator)
+		filePath = getCurrentDirectory(fileName_) + g_fileSeparator + filePath;
 
-	// sort the current entries for fileName
-	if (firstEntry < fileName.size())
-		sort(&fileName[firstEntry], &fileName[fileName.size()]);
+	string status;
+	string reply;
+	if (!requestFromServer("file", filePath, string(), status, reply))
+		error("Server error", reply.c_str());
 
-	// recurse into sub directories
-	// if not doing recursive, subDirectory is empty
-	if (subDirectory.size() > 1)
-		sort(subDirectory.begin(), subDirectory.end());
-	for (unsigned i = 0; i < subDirectory.size(); i++)
+	// remove targetDirectory from filename if required by print
+	string displayName;
+	if (hasWildcard)
+		displayName = fileName_.substr(targetDirectory.length() + 1);
+	else
+		displayName = fileName_;
+
+	if (status == "formatted")
+	{
+		printMsg(_("Formatted  %s\n"), displayName);
+		filesFormatted++;
+	}
+	else
 	{
-		getFileNames(subDirectory[i], wildcard);
+		if (!isFormattedOnly)
+			printMsg(_("Unchanged  %s\n"), displayName);
+		filesUnchanged++;
 	}
+}
 
-	return;
+/**
+ * LINUX function to send a request to the formatting server and get the reply.
+ * Connect to the server if it is the first request.
+ *
+ * @param kind          The request kind, "file" or "text".
+ * @param name          The file path, also used for the language mode.
+ * @param content       The text to be formatted for a "text" request.
+ * @param status        Receives "formatted", "unchanged", or "error".
+ * @param reply         Receives the formatted text or the error message.
+ * @return              false if the server returned an error.
+ */
+bool ASConsole::requestFromServer(const string &kind, const string &name, const string &content,
+                                  string &status, string &reply)
+{
+	if (serverIO == NULL)
+		connectToServer();
+	bool isSent = serverIO->writeField(kind)
+	              && serverIO->writeField(name)
+	              && serverIO->writeField(getRequestOptions())
+	              && serverIO->writeField(content)
+	              && serverIO->flush();
+	if (!isSent || !serverIO->readField(status) || !serverIO->readField(reply))
+		error("Lost connection to server", clientSocket.c_str());
+	return (status != "error");
+}
+
+/**
+ * LINUX function to run the formatting server from the server= option.
+ * This does not return.
+ */
+void ASConsole::runServer()
+{
+	ASServer server(*this);
+	server.run(serverSocket);
+}
+
+/**
+ * LINUX function to get the current directory.
+ * This is done if the fileName does not contain a path.
+ * It is probably from an editor sending a single file.
+ *
+ * @param fileName_     The filename is used only for  the error message.
+ * @return              The path of the current directory
+ */
+string ASConsole::getCurrentDirectory(const string &fileName_) const
+{
+	char* currdir = getenv("PWD");
+	if (currdir == NULL)
+		error("Cannot find file", fileName_.c_str());
+	return string(currdir);
 }
 
 /**
@@ -1326,14 +2208,18 @@ void ASConsole::launchDefaultBrowser(const char* filePathIn /*NULL*/) const
 
 #endif  // _WIN32
 
-// get individual file names from the command-line file path
-void ASConsole::getFilePaths(string &filePath)
+// get individual file names from the command-line file paths
+// the file paths are in the same directory and have wildcards if there is more than one
+void ASConsole::getFilePaths(const vector<string> &filePaths)
 {
 	fileName.clear();
 	targetDirectory = string();
 	targetFilename = string();
+	wildcards.clear();
+	wildcardHitsVector.clear();
 
 	// separate directory and file name
+	const string &filePath = filePaths[0];
 	size_t separator = filePath.find_last_of(g_fileSeparator);
 	if (separator == string::npos)
 	{
@@ -1349,10 +2235,16 @@ void ASConsole::getFilePaths(string &filePath)
 		mainDirectoryLength = targetDirectory.length() + 1;    // +1 includes trailing separator
 	}
 
-	if (targetFilename.length() == 0)
+	// the other file names use the same directory
+	vector<string> targetFilenames;
+	for (size_t i = 0; i < filePaths.size(); i++)
 	{
-		fprintf(stderr, _("Missing filename in %s\n"), filePath.c_str());
-		error();
+		targetFilenames.push_back(filePaths[i].substr(filePaths[i].find_last_of(g_fileSeparator) + 1));
+		if (targetFilenames[i].length() == 0)
+		{
+			fprintf(stderr, _("Missing filename in %s\n"), filePaths[i].c_str());
+			error();
+		}
 	}
 
 	// check filename for wildcards
@@ -1376,15 +2268,32 @@ void ASConsole::getFilePaths(string &filePath)
 	}
 
 	// display directory name for wildcard processing
+	// and compile the wildcards for the search
 	if (hasWildcard)
 	{
 		printSeparatingLine();
-		printMsg(_("Directory  %s\n"), targetDirectory + g_fileSeparator + targetFilename);
+		for (size_t i = 0; i < targetFilenames.size(); i++)
+		{
+			printMsg(_("Directory  %s\n"), targetDirectory + g_fileSeparator + targetFilenames[i]);
+			wildcards.push_back(ASWildcard(targetFilenames[i]));
+		}
+		wildcardHitsVector.resize(wildcards.size(), false);
 	}
 
 	// create a vector of paths and file names to process
+	bool isFormattedBySearch = false;
 	if (hasWildcard || isRecursive)
-		getFileNames(targetDirectory, targetFilename);
+	{
+#ifdef _WIN32
+		getFileNames(targetDirectory);
+#else
+		// the search formats the files as they are found
+		if (hasWildcard)
+			printSeparatingLine();
+		formatDirectoryTree(targetDirectory);
+		isFormattedBySearch = true;
+#endif
+	}
 	else
 	{
 		// verify a single file is not a directory (needed on Linux)
@@ -1395,28 +2304,7 @@ void ASConsole::getFilePaths(string &filePath)
 	}
 
 	// check for unprocessed excludes
-	bool excludeErr = false;
-	for (size_t ix = 0; ix < excludeHitsVector.size(); ix++)
-	{
-		if (excludeHitsVector[ix] == false)
-		{
-			excludeErr = true;
-			if (!ignoreExcludeErrorsDisplay)
-			{
-				if (ignoreExcludeErrors)
-					printMsg(_("Exclude (unmatched)  %s\n"), excludeVector[ix]);
-				else
-					fprintf(stderr, _("Exclude (unmatched)  %s\n"), excludeVector[ix].c_str());
-			}
-			else
-			{
-				if (!ignoreExcludeErrors)
-					fprintf(stderr, _("Exclude (unmatched)  %s\n"), excludeVector[ix].c_str());
-			}
-		}
-	}
-
-	if (excludeErr && !ignoreExcludeErrors)
+	if (checkExcludeHits())
 	{
 		if (hasWildcard && !isRecursive)
 			fprintf(stderr, "%s\n", _("Did you intend to use --recursive"));
@@ -1424,15 +2312,19 @@ void ASConsole::getFilePaths(string &filePath)
 	}
 
 	// check if files were found (probably an input error if not)
-	if (fileName.empty())
+	for (size_t i = 0; i < filePaths.size(); i++)
 	{
-		fprintf(stderr, _("No file to process %s\n"), filePath.c_str());
-		if (hasWildcard && !isRecursive)
-			fprintf(stderr, "%s\n", _("Did you intend to use --recursive"));
-		error();
+		bool isFound = hasWildcard ? wildcardHitsVector[i] : !fileName.empty();
+		if (!isFound)
+		{
+			fprintf(stderr, _("No file to process %s\n"), filePaths[i].c_str());
+			if (hasWildcard && !isRecursive)
+				fprintf(stderr, "%s\n", _("Did you intend to use --recursive"));
+			error();
+		}
 	}
 
-	if (hasWildcard)
+	if (hasWildcard && !isFormattedBySearch)
 		printSeparatingLine();
 }
 
@@ -1441,6 +2333,12 @@ bool ASConsole::fileNameVectorIsEmpty() const
 	return fileNameVector.empty();
 }
 
+// the check=fail-fast option stops at the first file that is not formatted
+bool ASConsole::isFailFastStop() const
+{
+	return (isCheckFailFast && filesFormatted > 0);
+}
+
 bool ASConsole::isOption(const string &arg, const char* op)
 {
 	return arg.compare(op) == 0;
@@ -1461,49 +2359,91 @@ bool ASConsole::isParamOption(const string &arg, const char* option)
 	return retVal;
 }
 
+// check if two command line file paths have wildcards in the same directory
+// they can be processed by one directory search
+bool ASConsole::isSameWildcardDirectory(const string &filePath1, const string &filePath2) const
+{
+	size_t separator1 = filePath1.find_last_of(g_fileSeparator);
+	size_t separator2 = filePath2.find_last_of(g_fileSeparator);
+	if (separator1 != separator2)
+		return false;
+	size_t nameStart = (separator1 == string::npos) ? 0 : separator1 + 1;
+	if (filePath1.find_first_of("*?", nameStart) == string::npos
+	        || filePath2.find_first_of("*?", nameStart) == string::npos)
+		return false;
+	return (filePath1.compare(0, nameStart, filePath2, 0, nameStart) == 0);
+}
+
 // compare a path to the exclude vector
 // used for both directories and filenames
 // updates the g_excludeHitsVector
 // return true if a match
 bool ASConsole::isPathExclued(const string &subPath)
 {
-	bool retVal = false;
+	int excludeIndex = findExclude(subPath);
+	if (excludeIndex < 0)
+		return false;
+	excludeHitsVector[excludeIndex] = true;
+	return true;
+}
 
-	// read the exclude vector checking for a match
-	for (size_t i = 0; i < excludeVector.size(); i++)
+// compare a file name to the wildcards of the current search
+// if wildcardHits is not NULL the wildcards matched are flagged
+// return true if a match
+bool ASConsole::matchesWildcard(const char* name, vector<bool>* wildcardHits /*NULL*/) const
+{
+	bool isMatch = false;
+	for (size_t i = 0; i < wildcards.size(); i++)
 	{
-		string exclude = excludeVector[i];
-
-		if (subPath.length() < exclude.length())
+		if (!wildcards[i].matches(name))
 			continue;
-
-		size_t compareStart = subPath.length() - exclude.length();
-		// subPath compare must start with a directory name
-		if (compareStart > 0)
-		{
-			char lastPathChar = subPath[compareStart - 1];
-			if (lastPathChar != g_fileSeparator)
-				continue;
-		}
-
-		string compare = subPath.substr(compareStart);
-		if (!g_isCaseSensitive)
-		{
-			// make it case insensitive for Windows
-			for (size_t j = 0; j < compare.length(); j++)
-				compare[j] = (char)tolower(compare[j]);
-			for (size_t j = 0; j < exclude.length(); j++)
-				exclude[j] = (char)tolower(exclude[j]);
-		}
-		// compare sub directory to exclude data - must check them all
-		if (compare == exclude)
-		{
-			excludeHitsVector[i] = true;
-			retVal = true;
+		isMatch = true;
+		if (wildcardHits == NULL)
 			break;
-		}
+		if (wildcardHits->size() < wildcards.size())
+			wildcardHits->resize(wildcards.size(), false);
+		(*wildcardHits)[i] = true;
 	}
-	return retVal;
+	return isMatch;
+}
+
+/**
+ * Create a console and formatter for a request with its own options.
+ * Used by the formatting server and the batch option.
+ * The options are set in the new console object without changing the
+ * main console or the global variables, so it may be called concurrently.
+ * The options for the whole process, such as verbose, are option errors.
+ *
+ * @param options       The new-line separated options.
+ * @param errorMsg      Receives the option errors if the options are not valid.
+ * @return              The new console, or NULL if the options are not valid.
+ *                      It must be deleted by deleteRequestConsole().
+ */
+ASConsole* ASConsole::newRequestConsole(const string &options, string &errorMsg) const
+{
+	// build the options vector
+	vector<string> requestOptions;
+	size_t start = 0;
+	while (start < options.length())
+	{
+		size_t end = options.find('\n', start);
+		if (end == string::npos)
+			end = options.length();
+		if (end > start)
+			requestOptions.push_back(options.substr(start, end - start));
+		start = end + 1;
+	}
+
+	ASFormatter* requestFormatter = new ASFormatter;
+	ASConsole* requestConsole = new ASConsole(*requestFormatter, &localizer);
+	ASOptions options_(*requestFormatter, *requestConsole, true);
+	if (!options_.parseOptions(requestOptions, "Invalid request options:"))
+	{
+		errorMsg = options_.getOptionErrors();
+		deleteRequestConsole(requestConsole);
+		return NULL;
+	}
+	return requestConsole;
 }
 
 void ASConsole::printHelp() const
@@ -1806,6 +2746,10 @@ void ASConsole::printHelp() const
 	cout << "    Don't break lines containing multiple statements into\n";
 	cout << "    multiple single-statement lines.\n";
 	cout << endl;
+	cout << "    --indent-only  OR  -xI\n";
+	cout << "    Indent the lines without changing anything else. The\n";
+	cout << "    other formatting options are ignored.\n";
+	cout << endl;
 	cout << "    --convert-tabs  OR  -c\n";
 	cout << "    Convert tabs to the appropriate number of spaces.\n";
 	cout << endl;
@@ -1871,6 +2815,11 @@ void ASConsole::printHelp() const
 	cout << "    --exclude=####\n";
 	cout << "    Specify a file or directory #### to be excluded from processing.\n";
 	cout << endl;
+	cout << "    --ignore-file=####\n";
+	cout << "    Use the ignore file #### in each directory searched (e.g.\n";
+	cout << "    .gitignore). The files and directories matching its patterns are\n";
+	cout << "    not processed, and ignored directories are not searched.\n";
+	cout << endl;
 	cout << "    --ignore-exclude-errors  OR  -i\n";
 	cout << "    Allow processing to continue if there are errors in the exclude=####\n";
 	cout << "    options. It will display the unmatched excludes.\n";
@@ -1890,6 +2839,15 @@ void ASConsole::printHelp() const
 	cout << "    --verbose  OR  -v\n";
 	cout << "    Verbose mode. Extra informational messages will be displayed.\n";
 	cout << endl;
+	cout << "    --profile\n";
+	cout << "    Display the time of each formatting phase for each file, and a\n";
+	cout << "    summary of the phases after the files are processed.\n";
+	cout << endl;
+	cout << "    --trace=####\n";
+	cout << "    Write the time spans of the files and the directory searches to\n";
+	cout << "    the file ####, in the Trace Event Format of the Chrome and\n";
+	cout << "    Perfetto trace viewers.\n";
+	cout << endl;
 	cout << "    --formatted  OR  -Q\n";
 	cout << "    Formatted display mode. Display only the files that have been\n";
 	cout << "    formatted.\n";
@@ -1912,6 +2870,36 @@ void ASConsole::printHelp() const
 	cout << "    Disable the default options file.\n";
 	cout << "    Only the command-line parameters will be used.\n";
 	cout << endl;
+	cout << "    --check  OR  --check=fail-fast\n";
+	cout << "    Check that the files are formatted without changing them.\n";
+	cout << "    The first line that is not formatted is displayed for each file.\n";
+	cout << "    The exit status is not zero if a file is not formatted.\n";
+	cout << "    With fail-fast the run stops at the first file not formatted.\n";
+	cout << endl;
+	cout << "    --files-from=####\n";
+	cout << "    Format the files listed in the file ####, or in stdin if #### is '-'.\n";
+	cout << "    The files are listed one per line and are processed without a\n";
+	cout << "    directory search. The exclude options are used for each file.\n";
+	cout << endl;
+	cout << "    --null  OR  -0\n";
+	cout << "    The files-from= list is separated by null characters instead of\n";
+	cout << "    new-lines. This is the output of 'find -print0'.\n";
+	cout << endl;
+	cout << "    --batch\n";
+	cout << "    Format a stream of length-prefixed records from stdin to stdout.\n";
+	cout << "    Each record has a name, options, and the text to be formatted.\n";
+	cout << "    A status and the formatted text are returned for each record.\n";
+	cout << endl;
+	cout << "    --server=####\n";
+	cout << "    Run as a formatting server on the Unix domain socket ####.\n";
+	cout << "    The requests from client= consoles are formatted until the\n";
+	cout << "    server is stopped. Formatters are reused for each set of options.\n";
+	cout << endl;
+	cout << "    --client=####\n";
+	cout << "    Send the files to the formatting server on the Unix domain\n";
+	cout << "    socket ####. The options are sent with the request and the\n";
+	cout << "    server formats the files. This option is not available on Windows.\n";
+	cout << endl;
 	cout << "    --ascii  OR  -I\n";
 	cout << "    The displayed output will be ascii characters only.\n";
 	cout << endl;
@@ -1941,21 +2929,142 @@ void ASConsole::processFiles()
 	if (isVerbose)
 		printVerboseHeader();
 
-	clock_t startTime = clock();     // start time of file formatting
+	double startTime = ASProfiler::getTime();   // wall clock start time of file formatting
+	if (isProfile || !traceFileName.empty())
+		ASProfiler::setIsEnabled(true);
+	if (!traceFileName.empty())
+		ASProfiler::setIsTracing(true);
+	ASProfiler::clearAllocStats();
 
 	// loop thru input fileNameVector and process the files
-	for (size_t i = 0; i < fileNameVector.size(); i++)
+	// the wildcards for the same directory are processed by one search
+	vector<bool> isSearched(fileNameVector.size(), false);
+	for (size_t i = 0; i < fileNameVector.size() && !isFailFastStop(); i++)
 	{
-		getFilePaths(fileNameVector[i]);
+		if (isSearched[i])
+			continue;
+		vector<string> filePaths(1, fileNameVector[i]);
+		for (size_t j = i + 1; j < fileNameVector.size(); j++)
+		{
+			if (!isSearched[j] && isSameWildcardDirectory(fileNameVector[i], fileNameVector[j]))
+			{
+				filePaths.push_back(fileNameVector[j]);
+				isSearched[j] = true;
+			}
+		}
+		getFilePaths(filePaths);
 
 		// loop thru fileName vector formatting the files
-		for (size_t j = 0; j < fileName.size(); j++)
+		for (size_t j = 0; j < fileName.size() && !isFailFastStop(); j++)
 			formatFile(fileName[j]);
 	}
 
+	// process the files listed by the files-from= option
+	if (!filesFromName.empty() && !isFailFastStop())
+		processFilesFrom();
+
 	// files are processed, display stats
 	if (isVerbose)
 		printVerboseStats(startTime);
+	if (isProfile)
+		printProfileStats(startTime);
+	if (!traceFileName.empty())
+	{
+		writeTraceFile();
+		ASProfiler::setIsTracing(false);
+	}
+	ASProfiler::setIsEnabled(false);
+}
+
+/**
+ * Process the files listed by the files-from= option.
+ * The paths are formatted as listed without a directory search.
+ * The list is separated by new-lines, or by nulls if the null option is used.
+ * The exclude options are applied to each path and to each of its directories
+ * below the current directory, as in a recursive search of the current directory.
+ * The complete list is read and the unmatched excludes are checked
+ * before any file is formatted.
+ */
+void ASConsole::processFilesFrom()
+{
+	FILE* listFile = stdin;
+	if (filesFromName != "-")
+	{
+		listFile = fopen(filesFromName.c_str(), "rb");
+		if (listFile == NULL)
+			error("Cannot open files-from list", filesFromName.c_str());
+	}
+
+	// the paths are displayed as listed
+	hasWildcard = false;
+	mainDirectoryLength = 0;
+	for (size_t ix = 0; ix < excludeHitsVector.size(); ix++)
+		excludeHitsVector[ix] = false;
+
+	const int separator = filesFromNull ? '\0' : '\n';
+	vector<string> filePaths;
+	vector<bool> isExcluded;
+	string currentDirectory;
+	string filePath;
+	int ch;
+	do
+	{
+		ch = getc(listFile);
+		if (ch != separator && ch != EOF)
+		{
+			filePath.append(1, static_cast<char>(ch));
+			continue;
+		}
+		// allow Windows line ends in a new-line separated list
+		if (!filesFromNull && !filePath.empty() && filePath[filePath.length() - 1] == '\r')
+			filePath.erase(filePath.length() - 1);
+		if (filePath.empty())
+			continue;
+		standardizePath(filePath);
+		// an excluded directory excludes the files in it, as in the directory search
+		// only the directories below the current directory are checked
+		size_t separatorPos = string::npos;
+		bool isAbsolutePath = (filePath[0] == g_fileSeparator
+		                       || (filePath.length() > 1 && filePath[1] == ':'));
+		if (isAbsolutePath)
+		{
+			if (currentDirectory.empty())
+				currentDirectory = getCurrentDirectory(filePath) + g_fileSeparator;
+			if (filePath.compare(0, currentDirectory.length(), currentDirectory) == 0)
+				separatorPos = filePath.find(g_fileSeparator, currentDirectory.length());
+		}
+		else if ((g_fileSeparator + filePath).find(string(1, g_fileSeparator) + "..") == string::npos)
+			separatorPos = filePath.find(g_fileSeparator, 1);
+		bool isPathExcluded = false;
+		while (separatorPos != string::npos && !isPathExcluded)
+		{
+			isPathExcluded = isPathExclued(filePath.substr(0, separatorPos));
+			separatorPos = filePath.find(g_fileSeparator, separatorPos + 1);
+		}
+		if (!isPathExcluded)
+			isPathExcluded = isPathExclued(filePath);
+		filePaths.push_back(filePath);
+		isExcluded.push_back(isPathExcluded);
+		filePath.clear();
+	}
+	while (ch != EOF);
+
+	if (ferror(listFile))
+		error("Error reading files-from list", filesFromName.c_str());
+	if (listFile != stdin)
+		fclose(listFile);
+
+	// check for unprocessed excludes
+	if (checkExcludeHits())
+		error();
+
+	for (size_t i = 0; i < filePaths.size() && !isFailFastStop(); i++)
+	{
+		if (isExcluded[i])
+			printMsg(_("Exclude  %s\n"), filePaths[i]);
+		else
+			formatFile(filePaths[i]);
+	}
 }
 
 // process options from the command line and options file
@@ -2008,6 +3117,48 @@ void ASConsole::processOptions(vector<string> &argvOptions)
 			launchDefaultBrowser(htmlFilePath.c_str());
 			exit(EXIT_SUCCESS);
 		}
+		else if ( isOption(arg, "--batch") )
+		{
+			isBatch = true;
+		}
+		else if ( isOption(arg, "--check") )
+		{
+			isCheck = true;
+		}
+		else if ( isOption(arg, "--check=fail-fast") )
+		{
+			isCheck = true;
+			isCheckFailFast = true;
+		}
+		else if ( isParamOption(arg, "--check=") )
+		{
+			error("Invalid check option", arg.c_str());
+		}
+		else if ( isParamOption(arg, "--files-from=") )
+		{
+			filesFromName = getParam(arg, "--files-from=");
+			if (filesFromName.empty())
+				error("Missing file name in", arg.c_str());
+		}
+		else if ( isOption(arg, "-0")
+		          || isOption(arg, "--null") )
+		{
+			filesFromNull = true;
+		}
+#ifndef _WIN32
+		else if ( isParamOption(arg, "--server=") )
+		{
+			serverSocket = getParam(arg, "--server=");
+			if (serverSocket.empty())
+				error("Missing socket path in", arg.c_str());
+		}
+		else if ( isParamOption(arg, "--client=") )
+		{
+			clientSocket = getParam(arg, "--client=");
+			if (clientSocket.empty())
+				error("Missing socket path in", arg.c_str());
+		}
+#endif
 		else if ( isOption(arg, "-V" )
 		          || isOption(arg, "--version") )
 		{
@@ -2051,7 +3202,7 @@ void ASConsole::processOptions(vector<string> &argvOptions)
 	}
 
 	// create the options file vector and parse the options for errors
-	ASOptions options(formatter);
+	ASOptions options(formatter, *this);
 	if (optionsFileName.compare("") != 0)
 	{
 		ifstream optionsIn(optionsFileName.c_str());
@@ -2085,10 +3236,12 @@ void ASConsole::processOptions(vector<string> &argvOptions)
 		(*_err) << _("For help on options type 'astyle -h'") << endl;
 		error();
 	}
+	requestOptions = options.getRequestOptions();
 }
 
 // remove a file and check for an error
-void ASConsole::removeFile(const char* fileName_, const char* errMsg) const
+// return false if the error is returned in errorMsg
+bool ASConsole::removeFile(const char* fileName_, const char* errMsg, string* errorMsg) const
 {
 	if (remove(fileName_))
 	{
@@ -2097,13 +3250,17 @@ void ASConsole::removeFile(const char* fileName_, const char* errMsg) const
 		if (errno)
 		{
 			perror("errno message");
-			error(errMsg, fileName_);
+			fileError(errMsg, fileName_, errorMsg);
+			return false;
 		}
 	}
+	return true;
 }
 
 // rename a file and check for an error
-void ASConsole::renameFile(const char* oldFileName, const char* newFileName, const char* errMsg) const
+// return false if the error is returned in errorMsg
+bool ASConsole::renameFile(const char* oldFileName, const char* newFileName, const char* errMsg,
+                           string* errorMsg) const
 {
 	int result = rename(oldFileName, newFileName);
 	if (result != 0)
@@ -2118,9 +3275,11 @@ void ASConsole::renameFile(const char* oldFileName, const char* newFileName, con
 		if (result != 0)
 		{
 			perror("errno message");
-			error(errMsg, oldFileName);
+			fileError(errMsg, oldFileName, errorMsg);
+			return false;
 		}
 	}
+	return true;
 }
 
 // make sure file separators are correct type (Windows or Linux)
@@ -2194,6 +3353,68 @@ void ASConsole::printMsg(const char* msg, const string &data) const
 	printf(msg, data.c_str());
 }
 
+// print the phase times of a file for the profile option
+// the times are the difference from the phase times at the start of the file
+// an allocation stats build also prints the allocations of the file
+void ASConsole::printProfileFile(const ASProfiler::PhaseStats* startStats,
+                                 const ASProfiler::AllocStats &startAllocStats,
+                                 int lines, double startTime) const
+{
+	if (isQuiet)
+		return;
+	ASProfiler::PhaseStats stats[ASProfiler::PHASE_COUNT];
+	ASProfiler::getPhaseStats(stats);
+	printf(" Profile  %.3f ms ", (ASProfiler::getTime() - startTime) * 1000);
+	for (int i = 0; i < ASProfiler::PHASE_COUNT; i++)
+	{
+		double selfTime = (stats[i].totalTime - stats[i].nestedTime)
+		                  - (startStats[i].totalTime - startStats[i].nestedTime);
+		printf("  %s %.3f", ASProfiler::getPhaseName(i), selfTime * 1000);
+	}
+	if (ASProfiler::hasAllocStats())
+	{
+		ASProfiler::AllocStats allocStats;
+		ASProfiler::getThreadAllocStats(&allocStats);
+		size_t allocations = allocStats.allocations - startAllocStats.allocations;
+		size_t bytes = allocStats.bytes - startAllocStats.bytes;
+		printf("  allocs %lu  KB %.1f  allocs/line %.1f", (unsigned long) allocations,
+		       bytes / 1024.0, lines > 0 ? double(allocations) / lines : 0);
+	}
+	printf("\n");
+}
+
+// print the phase times of all files for the profile option
+// the self time of a phase does not include the nested phases
+void ASConsole::printProfileStats(double startTime) const
+{
+	if (isQuiet)
+		return;
+	ASProfiler::PhaseStats stats[ASProfiler::PHASE_COUNT];
+	ASProfiler::getPhaseStats(stats);
+	double totalSelfTime = 0;
+	for (int i = 0; i < ASProfiler::PHASE_COUNT; i++)
+		totalSelfTime += stats[i].totalTime - stats[i].nestedTime;
+
+	printSeparatingLine();
+	printf(" %-12s %12s %12s %8s", "Profile", "calls", "self ms", "percent");
+	if (ASProfiler::hasAllocStats())
+		printf(" %12s %12s", "self allocs", "self KB");
+	printf("\n");
+	for (int i = 0; i < ASProfiler::PHASE_COUNT; i++)
+	{
+		double selfTime = stats[i].totalTime - stats[i].nestedTime;
+		double percent = totalSelfTime > 0 ? selfTime * 100 / totalSelfTime : 0;
+		printf(" %-12s %12d %12.3f %7.1f%%", ASProfiler::getPhaseName(i), stats[i].calls,
+		       selfTime * 1000, percent);
+		if (ASProfiler::hasAllocStats())
+			printf(" %12lu %12.1f", (unsigned long)(stats[i].allocations - stats[i].nestedAllocations),
+			       (stats[i].allocatedBytes - stats[i].nestedBytes) / 1024.0);
+		printf("\n");
+	}
+	double otherTime = (ASProfiler::getTime() - startTime) - totalSelfTime;
+	printf(" %-12s %12s %12.3f\n", "other", "", (otherTime > 0 ? otherTime : 0) * 1000);
+}
+
 void ASConsole::printSeparatingLine() const
 {
 	string line;
@@ -2221,7 +3442,7 @@ void ASConsole::printVerboseHeader() const
 		printf(_("Using default options file %s\n"), optionsFileName.c_str());
 }
 
-void ASConsole::printVerboseStats(clock_t startTime) const
+void ASConsole::printVerboseStats(double startTime) const
 {
 	assert(isVerbose);
 	if (isQuiet)
@@ -2233,8 +3454,8 @@ void ASConsole::printVerboseStats(clock_t startTime) const
 	printf(_(" %s formatted   %s unchanged   "), formatted.c_str(), unchanged.c_str());
 
 	// show processing time
-	clock_t stopTime = clock();
-	float secs = (stopTime - startTime) / float (CLOCKS_PER_SEC);
+	double totalSecs = ASProfiler::getTime() - startTime;
+	double secs = totalSecs;
 	if (secs < 60)
 	{
 		if (secs < 2.0)
@@ -2254,178 +3475,909 @@ void ASConsole::printVerboseStats(clock_t startTime) const
 		printf(_("%d min %d sec   "), min, minsec);
 	}
 
-	string lines = getNumberFormat(linesOut);
-	printf(_("%s lines\n"), lines.c_str());
+	string lines = getNumberFormat(linesOut);
+	printf(_("%s lines\n"), lines.c_str());
+
+	// show the throughput and where the time was spent
+	if (bytesRead > 0)
+	{
+		const double megabyte = 1024.0 * 1024.0;
+		printf(" %.2f MB read   %.2f MB written", bytesRead / megabyte, bytesWritten / megabyte);
+		if (totalSecs > 0)
+		{
+			string linesPerSec = getNumberFormat(int(linesOut / totalSecs));
+			printf("   %s lines/sec   %.2f MB/sec", linesPerSec.c_str(),
+			       bytesRead / megabyte / totalSecs);
+		}
+		printf("\n");
+		double otherSecs = totalSecs - readTime - formatTime - writeTime;
+		if (otherSecs < 0)
+			otherSecs = 0;
+		printf(" %.3f sec read   %.3f sec format   %.3f sec write   %.3f sec other\n",
+		       readTime, formatTime, writeTime, otherSecs);
+	}
+
+	// show the allocations of an allocation stats build
+	if (ASProfiler::hasAllocStats())
+	{
+		const double megabyte = 1024.0 * 1024.0;
+		ASProfiler::AllocStats allocStats;
+		ASProfiler::getAllocStats(&allocStats);
+		string allocations = getNumberFormat(static_cast<int>(allocStats.allocations));
+		printf(" %s allocations   %.2f MB allocated   %.2f MB peak   %.1f allocations/line\n",
+		       allocations.c_str(), allocStats.bytes / megabyte, allocStats.peakLiveBytes / megabyte,
+		       linesOut > 0 ? double(allocStats.allocations) / linesOut : 0);
+	}
+
+	// show the slowest files
+	if (!slowestFiles.empty())
+	{
+		printf(" Slowest files:\n");
+		for (size_t i = 0; i < slowestFiles.size(); i++)
+			printf("   %.3f sec   %s\n", slowestFiles[i].first, slowestFiles[i].second.c_str());
+	}
+
+	// show the directory search system calls
+	if (dirsOpened > 0)
+	{
+		string dirs = getNumberFormat(dirsOpened);
+		string stats = getNumberFormat(statCalls);
+		printf(" %s directories   %s file status calls\n", dirs.c_str(), stats.c_str());
+	}
+}
+
+void ASConsole::sleep(int seconds) const
+{
+	clock_t endwait;
+	endwait = clock_t (clock () + seconds * CLOCKS_PER_SEC);
+	while (clock() < endwait) {}
+}
+
+// keep the slowest files for the verbose stats, slowest first
+void ASConsole::updateSlowestFiles(const string &displayName, double seconds)
+{
+	const size_t maxSlowestFiles = 10;
+	if (slowestFiles.size() == maxSlowestFiles && seconds <= slowestFiles.back().first)
+		return;
+	vector<pair<double, string> >::iterator iter = slowestFiles.begin();
+	while (iter != slowestFiles.end() && iter->first >= seconds)
+		++iter;
+	slowestFiles.insert(iter, make_pair(seconds, displayName));
+	if (slowestFiles.size() > maxSlowestFiles)
+		slowestFiles.pop_back();
+}
+
+bool ASConsole::stringEndsWith(const string &str, const string &suffix) const
+{
+	int strIndex = (int) str.length() - 1;
+	int suffixIndex = (int) suffix.length() - 1;
+
+	while (strIndex >= 0 && suffixIndex >= 0)
+	{
+		if (tolower(str[strIndex]) != tolower(suffix[suffixIndex]))
+			return false;
+
+		--strIndex;
+		--suffixIndex;
+	}
+	// suffix longer than string
+	if (strIndex < 0 && suffixIndex >= 0)
+		return false;
+	return true;
+}
+
+void ASConsole::updateExcludeVector(string suffixParam)
+{
+	excludeVector.push_back(suffixParam);
+	standardizePath(excludeVector.back(), true);
+	excludeHitsVector.push_back(false);
+
+	// add the exclude to the trie from the last character
+	const string &exclude = excludeVector.back();
+	if (excludeTrie.empty())
+	{
+		ExcludeNode root = { '\0', -1, -1, -1 };
+		excludeTrie.push_back(root);
+	}
+	int node = 0;
+	for (size_t i = exclude.length(); i > 0; i--)
+	{
+		char ch = exclude[i - 1];
+		if (!g_isCaseSensitive)
+			ch = (char)tolower(ch);
+		int child = excludeTrie[node].firstChild;
+		while (child >= 0 && excludeTrie[child].ch != ch)
+			child = excludeTrie[child].nextSibling;
+		if (child < 0)
+		{
+			ExcludeNode newNode = { ch, -1, excludeTrie[node].firstChild, -1 };
+			excludeTrie.push_back(newNode);
+			child = excludeTrie.size() - 1;
+			excludeTrie[node].firstChild = child;
+		}
+		node = child;
+	}
+	// a duplicate exclude is not matched, the same as the first
+	if (excludeTrie[node].excludeIndex < 0)
+		excludeTrie[node].excludeIndex = excludeVector.size() - 1;
+}
+
+int ASConsole::waitForRemove(const char* newFileName) const
+{
+	struct stat stBuf;
+	int seconds;
+	// sleep a max of 20 seconds for the remove
+	for (seconds = 1; seconds <= 20; seconds++)
+	{
+		sleep(1);
+		if (stat(newFileName, &stBuf) != 0)
+			break;
+	}
+	errno = 0;
+	return seconds;
+}
+
+/**
+ * Write a file and convert utf-8 to utf-16 if it was utf-16.
+ * A backup is made unless the suffix=none option is used.
+ *
+ * @param fileName_     The path and name of the file to be written.
+ * @param encoding      The encoding of the file that was read.
+ * @param out           The formatted text.
+ * @param errorMsg      Receives an error instead of an error exit if it is not NULL.
+ */
+void ASConsole::writeFile(const string &fileName_, FileEncoding encoding, ostringstream &out,
+                          string* errorMsg) const
+{
+	ASProfileTimer timer(ASProfiler::WRITE_PHASE);
+	// save date accessed and date modified of original file
+	struct stat stBuf;
+	bool statErr = false;
+	if (stat(fileName_.c_str(), &stBuf) == -1)
+		statErr = true;
+
+	// create a backup
+	if (!noBackup)
+	{
+		string origFileName = fileName_ + origSuffix;
+		if (!removeFile(origFileName.c_str(), "Cannot remove pre-existing backup file", errorMsg)
+		        || !renameFile(fileName_.c_str(), origFileName.c_str(), "Cannot create backup file", errorMsg))
+			return;
+	}
+
+	// write the output file
+	ofstream fout(fileName_.c_str(), ios::binary | ios::trunc);
+	if (!fout)
+	{
+		fileError("Cannot open output file", fileName_.c_str(), errorMsg);
+		return;
+	}
+	if (encoding == UTF_16LE || encoding == UTF_16BE)
+	{
+		// convert utf-8 to utf-16
+		bool isBigEndian = (encoding == UTF_16BE);
+		size_t utf16Size = utf8_16.Utf16LengthFromUtf8(out.str().c_str(), out.str().length());
+		char* utf16Out = new(nothrow) char[utf16Size];
+		if (!utf16Out)
+		{
+			fileError("Cannot allocate memory for utf-16 conversion", fileName_.c_str(), errorMsg);
+			return;
+		}
+		size_t utf16Len = utf8_16.Utf8ToUtf16(const_cast<char*>(out.str().c_str()),
+		                                      out.str().length(), isBigEndian, utf16Out);
+		assert(utf16Len == utf16Size);
+		fout << string(utf16Out, utf16Len);
+		delete [] utf16Out;
+	}
+	else
+		fout << out.str();
+
+	fout.close();
+
+	// change date modified to original file date
+	// Embarcadero must be linked with cw32mt not cw32
+	if (preserveDate)
+	{
+		if (!statErr)
+		{
+			struct utimbuf outBuf;
+			outBuf.actime = stBuf.st_atime;
+			// add ticks so 'make' will recognize a change
+			// Visual Studio 2008 needs more than 1
+			outBuf.modtime = stBuf.st_mtime + 10;
+			if (utime(fileName_.c_str(), &outBuf) == -1)
+				statErr = true;
+		}
+		if (statErr)
+		{
+			perror("errno message");
+			(*_err) << "*********  Cannot preserve file date" << endl;
+		}
+	}
+}
+
+/**
+ * Write the trace events to the trace= file.
+ * The file is in the Trace Event Format of the Chrome and Perfetto trace viewers.
+ * The times are in microseconds from the start of the trace.
+ */
+void ASConsole::writeTraceFile() const
+{
+	ofstream fout(traceFileName.c_str(), ios::binary | ios::trunc);
+	if (!fout)
+		error(_("Cannot open trace file"), traceFileName.c_str());
+	fout.setf(ios::fixed);
+	fout.precision(3);
+
+	const vector<ASProfiler::TraceEvent> &events = ASProfiler::getTraceEvents();
+	double traceStartTime = ASProfiler::getTraceStartTime();
+	fout << "{\"traceEvents\":[\n";
+	fout << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+	     << "\"args\":{\"name\":\"console\"}}";
+	// name the search threads that have an event
+	vector<bool> isThreadNamed(1, true);
+	for (size_t i = 0; i < events.size(); i++)
+	{
+		size_t threadId = events[i].threadId;
+		if (threadId >= isThreadNamed.size())
+			isThreadNamed.resize(threadId + 1, false);
+		if (isThreadNamed[threadId])
+			continue;
+		isThreadNamed[threadId] = true;
+		fout << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+		     << ",\"args\":{\"name\":\"search " << threadId << "\"}}";
+	}
+	for (size_t i = 0; i < events.size(); i++)
+	{
+		const ASProfiler::TraceEvent &event = events[i];
+		fout << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"astyle\",\"ph\":\"X\""
+		     << ",\"pid\":1,\"tid\":" << event.threadId
+		     << ",\"ts\":" << (event.startTime - traceStartTime) * 1000000
+		     << ",\"dur\":" << event.duration * 1000000;
+		if (!event.detail.empty())
+			fout << ",\"args\":{\"name\":\"" << getJsonString(event.detail) << "\"}";
+		fout << "}";
+	}
+	fout << "\n]}\n";
+	fout.close();
+	if (!fout)
+		error(_("Cannot write trace file"), traceFileName.c_str());
+}
+
+//-----------------------------------------------------------------------------
+// ASServer class
+// formatting server for the console build
+//-----------------------------------------------------------------------------
+
+#ifndef _WIN32  // Linux specific
+
+ASServer::ASServer(ASConsole &consoleArg) : console(consoleArg)
+{
+	pthread_mutex_init(&cacheMutex, NULL);
+	pthread_mutex_init(&printMutex, NULL);
+	requestsProcessed = 0;
+}
+
+ASServer::~ASServer()
+{
+	for (size_t i = 0; i < allConsoles.size(); i++)
+		ASConsole::deleteRequestConsole(allConsoles[i]);
+	pthread_mutex_destroy(&cacheMutex);
+	pthread_mutex_destroy(&printMutex);
+}
+
+/**
+ * LINUX function to get an idle request console for an options fingerprint.
+ * A new console and formatter are created if there is not an idle one.
+ *
+ * @param options       The new-line separated options from the request.
+ * @param errorMsg      Receives the option errors if the options are not valid.
+ * @return              The request console, or NULL if the options are not valid.
+ */
+ASConsole* ASServer::acquireConsole(const string &options, string &errorMsg)
+{
+	pthread_mutex_lock(&cacheMutex);
+	ASConsole* requestConsole = NULL;
+	vector<ASConsole*> &idle = idleConsoles[options];
+	if (!idle.empty())
+	{
+		requestConsole = idle.back();
+		idle.pop_back();
+	}
+	else
+	{
+		requestConsole = console.newRequestConsole(options, errorMsg);
+		if (requestConsole != NULL)
+			allConsoles.push_back(requestConsole);
+	}
+	pthread_mutex_unlock(&cacheMutex);
+	return requestConsole;
+}
+
+// LINUX function to check that a client connection is from the user running the server
+// the server can rewrite any file the user can write, so other users are rejected
+bool ASServer::isServerUser(int connectionFd) const
+{
+#ifdef SO_PEERCRED
+	struct ucred credentials;
+	socklen_t credentialsLength = sizeof(credentials);
+	if (getsockopt(connectionFd, SOL_SOCKET, SO_PEERCRED, &credentials, &credentialsLength) != 0)
+		return false;
+	return (credentials.uid == getuid());
+#else
+	uid_t peerUid;
+	gid_t peerGid;
+	if (getpeereid(connectionFd, &peerUid, &peerGid) != 0)
+		return false;
+	return (peerUid == getuid());
+#endif
+}
+
+// LINUX function to start a thread for a client connection
+void* ASServer::connectionThread(void* arg)
+{
+	ServerConnection* connection = static_cast<ServerConnection*>(arg);
+	connection->server->processConnection(connection->connectionFd);
+	delete connection;
+	return NULL;
+}
+
+/**
+ * LINUX function to process the requests on a client connection.
+ * Each connection is processed in its own thread.
+ * The connection is closed when the client closes it.
+ *
+ * @param connectionFd  The socket of the client connection.
+ */
+void ASServer::processConnection(int connectionFd)
+{
+	FILE* clientIn = fdopen(connectionFd, "rb");
+	FILE* clientOut = fdopen(dup(connectionFd), "wb");
+	if (clientIn == NULL || clientOut == NULL)
+	{
+		if (clientIn != NULL)
+			fclose(clientIn);
+		else
+			close(connectionFd);
+		if (clientOut != NULL)
+			fclose(clientOut);
+		return;
+	}
+	ASRecordIO recordIO(clientIn, clientOut);
+	while (processRequest(recordIO))
+		continue;
+	recordIO.close();
+}
+
+/**
+ * LINUX function to process a request from a client.
+ * A request has the fields kind, name, options, and content.
+ * The reply has the fields status and text.
+ * A "file" request formats the file in place.
+ * A "text" request returns the formatted content.
+ *
+ * @param recordIO      The client connection.
+ * @return              false if the connection should be closed.
+ */
+bool ASServer::processRequest(ASRecordIO &recordIO)
+{
+	string kind;
+	string name;
+	string options;
+	string content;
+	if (!recordIO.readField(kind)
+	        || !recordIO.readField(name)
+	        || !recordIO.readField(options)
+	        || !recordIO.readField(content))
+		return false;
+
+	struct timespec startTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	string status = "error";
+	string reply;
+	ASConsole* requestConsole = acquireConsole(options, reply);
+	if (requestConsole != NULL)
+	{
+		stringstream in;
+		ostringstream out;
+		requestConsole->setLanguageMode(name);
+		if (kind == "file")
+		{
+			// an unreadable file must not stop the server
+			if (access(name.c_str(), R_OK | W_OK) != 0)
+				reply = "Cannot open input file " + name;
+			else
+			{
+				// the read and write errors are returned in reply
+				FileEncoding encoding = requestConsole->readFile(name, in, &reply);
+				if (reply.empty())
+				{
+					bool isFormatted = requestConsole->formatStream(in, out);
+					if (isFormatted && !requestConsole->getIsDryRun())
+						requestConsole->writeFile(name, encoding, out, &reply);
+					if (reply.empty())
+						status = isFormatted ? "formatted" : "unchanged";
+				}
+			}
+		}
+		else if (kind == "text")
+		{
+			in << content;
+			bool isFormatted = requestConsole->formatStream(in, out);
+			status = isFormatted ? "formatted" : "unchanged";
+			reply = out.str();
+		}
+		else
+			reply = "Invalid server request " + kind;
+		releaseConsole(options, requestConsole);
+	}
+
+	struct timespec stopTime;
+	clock_gettime(CLOCK_MONOTONIC, &stopTime);
+	double msecs = (stopTime.tv_sec - startTime.tv_sec) * 1000.0
+	               + (stopTime.tv_nsec - startTime.tv_nsec) / 1000000.0;
+
+	// report the request latency
+	pthread_mutex_lock(&printMutex);
+	requestsProcessed++;
+	if (!console.getIsQuiet())
+	{
+		printf("%-10s %s   %.3f ms\n", status.c_str(), name.c_str(), msecs);
+		fflush(stdout);
+	}
+	pthread_mutex_unlock(&printMutex);
+
+	return (recordIO.writeField(status)
+	        && recordIO.writeField(reply)
+	        && recordIO.flush());
+}
+
+// LINUX function to return a request console to the cache for reuse
+void ASServer::releaseConsole(const string &options, ASConsole* requestConsole)
+{
+	pthread_mutex_lock(&cacheMutex);
+	idleConsoles[options].push_back(requestConsole);
+	pthread_mutex_unlock(&cacheMutex);
+}
+
+/**
+ * LINUX function to run the server on a Unix domain socket.
+ * Each client connection is processed in a new thread.
+ * This does not return.
+ *
+ * @param socketPath    The path of the socket to create.
+ */
+void ASServer::run(const string &socketPath)
+{
+	struct sockaddr_un address;
+	if (socketPath.length() >= sizeof(address.sun_path))
+		console.error("Socket path is too long", socketPath.c_str());
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, socketPath.c_str());
+
+	// remove a socket left by a previous server, but not any other file
+	struct stat statbuf;
+	if (lstat(socketPath.c_str(), &statbuf) == 0 && S_ISSOCK(statbuf.st_mode))
+		unlink(socketPath.c_str());
+
+	// the socket is created with access for the user only
+	mode_t oldMask = umask(S_IRWXG | S_IRWXO);
+	int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+	bool isBound = (listenFd >= 0
+	                && bind(listenFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == 0);
+	umask(oldMask);
+	if (!isBound
+	        || chmod(socketPath.c_str(), S_IRUSR | S_IWUSR) != 0
+	        || listen(listenFd, SOMAXCONN) != 0)
+	{
+		perror("errno message");
+		console.error("Cannot create server socket", socketPath.c_str());
+	}
+
+	// a client closing the connection must not stop the server
+	signal(SIGPIPE, SIG_IGN);
+
+	if (!console.getIsQuiet())
+	{
+		printf("Artistic Style %s server on %s\n", g_version, socketPath.c_str());
+		fflush(stdout);
+	}
+
+	while (true)
+	{
+		int connectionFd = accept(listenFd, NULL, NULL);
+		if (connectionFd < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			perror("errno message");
+			console.error("Cannot accept connection on", socketPath.c_str());
+		}
+		if (!isServerUser(connectionFd))
+		{
+			close(connectionFd);
+			pthread_mutex_lock(&printMutex);
+			if (!console.getIsQuiet())
+			{
+				printf("Rejected connection from another user on %s\n", socketPath.c_str());
+				fflush(stdout);
+			}
+			pthread_mutex_unlock(&printMutex);
+			continue;
+		}
+		ServerConnection* connection = new ServerConnection;
+		connection->server = this;
+		connection->connectionFd = connectionFd;
+		pthread_t thread;
+		if (pthread_create(&thread, NULL, connectionThread, connection) != 0)
+		{
+			perror("errno message");
+			console.error("Cannot create thread for", socketPath.c_str());
+		}
+		pthread_detach(thread);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// ASDirectoryWalker class
+// parallel directory search for the console build recursive option
+//-----------------------------------------------------------------------------
+
+ASDirectoryWalker::ASDirectoryWalker(const ASConsole &consoleArg)
+	: console(consoleArg)
+{
+	ignoreFileName = console.getIgnoreFileName();
+	isRecursive = console.getIsRecursive();
+	pthread_mutex_init(&walkMutex, NULL);
+	pthread_cond_init(&workCond, NULL);
+	pthread_cond_init(&searchedCond, NULL);
+	pendingEntries = 0;
+	maxPendingEntries = 10000;
+	isShutdown = false;
+
+	// the search waits on I/O so use at least two threads
+	// a single directory is searched by the console
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	size_t threadCount = 2;
+	if (processors > 2)
+		threadCount = (processors < 8) ? processors : 8;
+	if (!isRecursive)
+		threadCount = 0;
+
+	// the last deque is used by the console
+	queues.resize(threadCount + 1);
+	threadArgs.resize(threadCount);
+	for (size_t i = 0; i < threadCount; i++)
+	{
+		threadArgs[i].walker = this;
+		threadArgs[i].queueIndex = i;
+		pthread_t thread;
+		// if a thread cannot be created the console searches the directories
+		if (pthread_create(&thread, NULL, walkerThread, &threadArgs[i]) != 0)
+			break;
+		threads.push_back(thread);
+	}
 }
 
-void ASConsole::sleep(int seconds) const
+ASDirectoryWalker::~ASDirectoryWalker()
 {
-	clock_t endwait;
-	endwait = clock_t (clock () + seconds * CLOCKS_PER_SEC);
-	while (clock() < endwait) {}
+	pthread_mutex_lock(&walkMutex);
+	isShutdown = true;
+	pthread_cond_broadcast(&workCond);
+	pthread_mutex_unlock(&walkMutex);
+	for (size_t i = 0; i < threads.size(); i++)
+		pthread_join(threads[i], NULL);
+
+	// the console deletes the directories it has processed
+	for (size_t i = 0; i < queues.size(); i++)
+		for (size_t j = 0; j < queues[i].size(); j++)
+			delete queues[i][j];
+
+	pthread_mutex_destroy(&walkMutex);
+	pthread_cond_destroy(&workCond);
+	pthread_cond_destroy(&searchedCond);
 }
 
-bool ASConsole::stringEndsWith(const string &str, const string &suffix) const
+// LINUX function to create a directory to be searched
+ASDirectoryWalker::WalkDirectory* ASDirectoryWalker::newDirectory(const string &path,
+        const ASIgnoreRules* parentIgnoreRules) const
 {
-	int strIndex = (int) str.length() - 1;
-	int suffixIndex = (int) suffix.length() - 1;
+	WalkDirectory* dir = new WalkDirectory;
+	dir->path = path;
+	dir->parentIgnoreRules = parentIgnoreRules;
+	dir->state = WALK_QUEUED;
+	dir->queueIndex = 0;
+	dir->isProcessed = false;
+	dir->nextSubDirectory = 0;
+	dir->pendingEntries = 0;
+	dir->dirsOpened = 0;
+	dir->statCalls = 0;
+	dir->searchThread = 0;
+	dir->searchStartTime = 0;
+	dir->searchEndTime = 0;
+	dir->errorMsg = NULL;
+	dir->errorNumber = 0;
+	return dir;
+}
 
-	while (strIndex >= 0 && suffixIndex >= 0)
+/**
+ * LINUX function to queue the sub directories of a searched directory.
+ * The walkMutex must be locked.
+ * They are queued in reverse order so the first is the next to be searched.
+ *
+ * @param dir           The directory that has been searched.
+ * @param queueIndex    The deque to receive the sub directories.
+ */
+void ASDirectoryWalker::queueSubDirectories(WalkDirectory* dir, size_t queueIndex)
+{
+	if (dir->subDirectories.empty())
+		return;
+	for (size_t i = dir->subDirectories.size(); i > 0; i--)
 	{
-		if (tolower(str[strIndex]) != tolower(suffix[suffixIndex]))
-			return false;
-
-		--strIndex;
-		--suffixIndex;
+		dir->subDirectories[i - 1]->queueIndex = queueIndex;
+		queues[queueIndex].push_back(dir->subDirectories[i - 1]);
 	}
-	// suffix longer than string
-	if (strIndex < 0 && suffixIndex >= 0)
-		return false;
-	return true;
+	pthread_cond_broadcast(&workCond);
 }
 
-void ASConsole::updateExcludeVector(string suffixParam)
+/**
+ * LINUX function to release the entries of a directory processed by the console.
+ * The files are deleted and the threads may search more directories.
+ *
+ * @param dir           The directory that has been processed.
+ */
+void ASDirectoryWalker::releaseDirectory(WalkDirectory* dir)
 {
-	excludeVector.push_back(suffixParam);
-	standardizePath(excludeVector.back(), true);
-	excludeHitsVector.push_back(false);
+	vector<string>().swap(dir->files);
+	vector<string>().swap(dir->excluded);
+	pthread_mutex_lock(&walkMutex);
+	pendingEntries -= dir->pendingEntries;
+	dir->pendingEntries = 0;
+	pthread_cond_broadcast(&workCond);
+	pthread_mutex_unlock(&walkMutex);
 }
 
-int ASConsole::waitForRemove(const char* newFileName) const
+/**
+ * LINUX function to search a directory for files and sub directories.
+ * The directory is owned by the caller while it is being searched.
+ * This is the only Linux directory search, for both the wildcard and the
+ * recursive options. The sub directories are saved only if recursive.
+ * Errors are saved in the directory to be displayed by the console.
+ *
+ * @param dir           The directory to be searched.
+ */
+void ASDirectoryWalker::searchDirectory(WalkDirectory* dir) const
 {
-	struct stat stBuf;
-	int seconds;
-	// sleep a max of 20 seconds for the remove
-	for (seconds = 1; seconds <= 20; seconds++)
+	struct dirent* entry;           // entry from readdir()
+	struct stat statbuf;            // entry from fstatat()
+	vector<string> subDirectory;    // sub directories of this directory
+
+	// errno is set for errors in opendir, readdir, or stat
+	errno = 0;
+
+	dir->searchStartTime = ASProfiler::getTime();
+	DIR* dp = opendir(dir->path.c_str());
+	if (dp == NULL)
 	{
-		sleep(1);
-		if (stat(newFileName, &stBuf) != 0)
-			break;
+		dir->errorMsg = "Cannot open directory";
+		dir->errorNumber = errno;
+		dir->searchEndTime = ASProfiler::getTime();
+		return;
 	}
-	errno = 0;
-	return seconds;
-}
+	dir->dirsOpened++;
+	// the file status is relative to the directory
+	int dirFd = dirfd(dp);
 
-// From The Code Project http://www.codeproject.com/string/wildcmp.asp
-// Written by Jack Handy - jakkhandy@hotmail.com
-// Modified to compare case insensitive for Windows
-int ASConsole::wildcmp(const char* wild, const char* data) const
-{
-	const char* cp = NULL, *mp = NULL;
-	bool cmpval;
+	// read the ignore file, the rules are used for the sub directories
+	// the parent directory is not deleted until the sub directories are processed
+	const ASIgnoreRules* ignoreRules = dir->parentIgnoreRules;
+	if (!ignoreFileName.empty()
+	        && dir->ignoreRules.readIgnoreFile(dir->path, ignoreFileName, ignoreRules))
+		ignoreRules = &dir->ignoreRules;
 
-	while ((*data) && (*wild != '*'))
+	// save files and sub directories
+	while ((entry = readdir(dp)) != NULL)
 	{
-		if (!g_isCaseSensitive)
-			cmpval = (tolower(*wild) != tolower(*data)) && (*wild != '?');
-		else
-			cmpval = (*wild != *data) && (*wild != '?');
+		// skip hidden before getting the file status
+		if (entry->d_name[0] == '.')
+			continue;
+		string entryFilepath = dir->path + g_fileSeparator + entry->d_name;
 
-		if (cmpval)
+#ifdef DT_UNKNOWN
+		// use the entry type to avoid the file status when it is not needed
+		// symbolic links and unknown types need the file status
+		if (entry->d_type == DT_DIR)
+		{
+			if (!isRecursive)
+				continue;
+		}
+		else if (entry->d_type == DT_REG)
 		{
-			return 0;
+			// a file that is not processed is still checked for an exclude hit
+			if (!console.matchesWildcard(entry->d_name)
+			        && console.findExclude(entryFilepath) < 0)
+				continue;
 		}
-		wild++;
-		data++;
-	}
+		else if (entry->d_type != DT_LNK
+		         && entry->d_type != DT_UNKNOWN)
+			continue;
+#endif
 
-	while (*data)
-	{
-		if (*wild == '*')
+		// get file status, needed for the read only check
+		dir->statCalls++;
+		if (fstatat(dirFd, entry->d_name, &statbuf, 0) != 0)
 		{
-			if (!*++wild)
+			if (errno == EOVERFLOW)         // file over 2 GB is OK
 			{
-				return 1;
+				errno = 0;
+				continue;
 			}
-			mp = wild;
-			cp = data + 1;
+			dir->errorMsg = "Error getting file status in directory";
+			dir->errorNumber = errno;
+			break;
 		}
-		else
+		// skip read only
+		if (!(statbuf.st_mode & S_IWUSR))
+			continue;
+		// if a sub directory and recursive, save sub directory
+		if (S_ISDIR(statbuf.st_mode) && isRecursive)
 		{
-			if (!g_isCaseSensitive)
-				cmpval = (tolower(*wild) == tolower(*data) || (*wild == '?'));
-			else
-				cmpval = (*wild == *data) || (*wild == '?');
-
-			if (cmpval)
+			int excludeIndex = console.findExclude(entryFilepath);
+			if (excludeIndex >= 0)
 			{
-				wild++;
-				data++;
+				dir->excludeHits.push_back(excludeIndex);
+				dir->excluded.push_back(entryFilepath);
 			}
-			else
+			else if (ignoreRules == NULL || !ignoreRules->isIgnored(entryFilepath, true))
+				subDirectory.push_back(entryFilepath);
+			continue;
+		}
+
+		// if a file, save file name
+		if (S_ISREG(statbuf.st_mode))
+		{
+			// check exclude before the wildcards to avoid "unmatched exclude" error
+			int excludeIndex = console.findExclude(entryFilepath);
+			if (excludeIndex >= 0)
+				dir->excludeHits.push_back(excludeIndex);
+			else if (ignoreRules != NULL && ignoreRules->isIgnored(entryFilepath, false))
+				continue;
+			// save file name if wildcard match
+			if (console.matchesWildcard(entry->d_name,
+			                            excludeIndex >= 0 ? NULL : &dir->wildcardHits))
 			{
-				wild = mp;
-				data = cp++;
+				if (excludeIndex >= 0)
+					dir->excluded.push_back(entryFilepath);
+				else
+					dir->files.push_back(entryFilepath);
 			}
 		}
 	}
 
-	while (*wild == '*')
+	if (closedir(dp) != 0 && dir->errorMsg == NULL)
 	{
-		wild++;
+		dir->errorMsg = "Error reading directory";
+		dir->errorNumber = errno;
 	}
-	return !*wild;
+
+	// sort the entries so the console processes them in order
+	sort(dir->files.begin(), dir->files.end());
+	sort(dir->excluded.begin(), dir->excluded.end());
+	sort(subDirectory.begin(), subDirectory.end());
+	for (size_t i = 0; i < subDirectory.size(); i++)
+		dir->subDirectories.push_back(newDirectory(subDirectory[i], ignoreRules));
+	dir->pendingEntries = dir->files.size() + dir->excluded.size() + subDirectory.size() + 1;
+	dir->searchEndTime = ASProfiler::getTime();
 }
 
-void ASConsole::writeFile(const string &fileName_, FileEncoding encoding, ostringstream &out) const
+/**
+ * LINUX function to start the search of a directory tree.
+ * The top directory is queued in the console's deque.
+ *
+ * @param directory     The path of the top directory.
+ * @return              The top directory, to be deleted by the console.
+ */
+ASDirectoryWalker::WalkDirectory* ASDirectoryWalker::start(const string &directory)
 {
-	// save date accessed and date modified of original file
-	struct stat stBuf;
-	bool statErr = false;
-	if (stat(fileName_.c_str(), &stBuf) == -1)
-		statErr = true;
-
-	// create a backup
-	if (!noBackup)
-	{
-		string origFileName = fileName_ + origSuffix;
-		removeFile(origFileName.c_str(), "Cannot remove pre-existing backup file");
-		renameFile(fileName_.c_str(), origFileName.c_str(), "Cannot create backup file");
-	}
-
-	// write the output file
-	ofstream fout(fileName_.c_str(), ios::binary | ios::trunc);
-	if (!fout)
-		error("Cannot open output file", fileName_.c_str());
-	if (encoding == UTF_16LE || encoding == UTF_16BE)
-	{
-		// convert utf-8 to utf-16
-		bool isBigEndian = (encoding == UTF_16BE);
-		size_t utf16Size = utf8_16.Utf16LengthFromUtf8(out.str().c_str(), out.str().length());
-		char* utf16Out = new char[utf16Size];
-		size_t utf16Len = utf8_16.Utf8ToUtf16(const_cast<char*>(out.str().c_str()),
-		                                      out.str().length(), isBigEndian, utf16Out);
-		assert(utf16Len == utf16Size);
-		fout << string(utf16Out, utf16Len);
-		delete [] utf16Out;
-	}
-	else
-		fout << out.str();
+	WalkDirectory* dir = newDirectory(directory, NULL);
+	pthread_mutex_lock(&walkMutex);
+	dir->queueIndex = queues.size() - 1;
+	queues[dir->queueIndex].push_back(dir);
+	pthread_cond_broadcast(&workCond);
+	pthread_mutex_unlock(&walkMutex);
+	return dir;
+}
 
-	fout.close();
+/**
+ * LINUX function to wait until a directory has been searched.
+ * If a thread has not started the directory the console searches it,
+ * so the console does not wait for the threads searching ahead.
+ *
+ * @param dir           The directory the console will process next.
+ */
+void ASDirectoryWalker::waitForDirectory(WalkDirectory* dir)
+{
+	pthread_mutex_lock(&walkMutex);
+	if (dir->state == WALK_QUEUED)
+	{
+		deque<WalkDirectory*> &queue = queues[dir->queueIndex];
+		queue.erase(find(queue.begin(), queue.end(), dir));
+		dir->state = WALK_SEARCHING;
+		dir->searchThread = 0;
+		pthread_mutex_unlock(&walkMutex);
+		searchDirectory(dir);
+		pthread_mutex_lock(&walkMutex);
+		dir->state = WALK_SEARCHED;
+		pendingEntries += dir->pendingEntries;
+		queueSubDirectories(dir, queues.size() - 1);
+	}
+	while (dir->state != WALK_SEARCHED)
+		pthread_cond_wait(&searchedCond, &walkMutex);
+	pthread_mutex_unlock(&walkMutex);
+}
 
-	// change date modified to original file date
-	// Embarcadero must be linked with cw32mt not cw32
-	if (preserveDate)
+/**
+ * LINUX function to search directories until the walker is shut down.
+ * A thread uses the newest directory in its own deque, which is usually
+ * the next one the console needs. If it is empty it steals the oldest
+ * directory from another deque. The search stops while the console has
+ * too many entries waiting to be processed.
+ *
+ * @param queueIndex    The thread's deque.
+ */
+void ASDirectoryWalker::walk(size_t queueIndex)
+{
+	pthread_mutex_lock(&walkMutex);
+	while (!isShutdown)
 	{
-		if (!statErr)
+		WalkDirectory* dir = NULL;
+		if (pendingEntries < maxPendingEntries)
 		{
-			struct utimbuf outBuf;
-			outBuf.actime = stBuf.st_atime;
-			// add ticks so 'make' will recognize a change
-			// Visual Studio 2008 needs more than 1
-			outBuf.modtime = stBuf.st_mtime + 10;
-			if (utime(fileName_.c_str(), &outBuf) == -1)
-				statErr = true;
+			if (!queues[queueIndex].empty())
+			{
+				dir = queues[queueIndex].back();
+				queues[queueIndex].pop_back();
+			}
+			for (size_t i = 1; i < queues.size() && dir == NULL; i++)
+			{
+				deque<WalkDirectory*> &victim = queues[(queueIndex + i) % queues.size()];
+				if (!victim.empty())
+				{
+					dir = victim.front();
+					victim.pop_front();
+				}
+			}
 		}
-		if (statErr)
+		if (dir == NULL)
 		{
-			perror("errno message");
-			(*_err) << "*********  Cannot preserve file date" << endl;
+			pthread_cond_wait(&workCond, &walkMutex);
+			continue;
 		}
-	}
+		dir->state = WALK_SEARCHING;
+		dir->searchThread = queueIndex + 1;
+		pthread_mutex_unlock(&walkMutex);
+		searchDirectory(dir);
+		pthread_mutex_lock(&walkMutex);
+		dir->state = WALK_SEARCHED;
+		pendingEntries += dir->pendingEntries;
+		queueSubDirectories(dir, queueIndex);
+		pthread_cond_broadcast(&searchedCond);
+	}
+	pthread_mutex_unlock(&walkMutex);
+}
+
+// LINUX function to start a thread of the pool
+void* ASDirectoryWalker::walkerThread(void* arg)
+{
+	WalkerThread* walkerThread_ = static_cast<WalkerThread*>(arg);
+	walkerThread_->walker->walk(walkerThread_->queueIndex);
+	return NULL;
 }
 
+#endif	// _WIN32
+
 //-----------------------------------------------------------------------------
 // ASLibrary class
 // used by shared object (DLL) calls
@@ -2598,6 +4550,19 @@ bool ASOptions::parseOptions(vector<string> &optionsVector, const string &errorI
 
 void ASOptions::parseOption(const string &arg, const string &errorInfo)
 {
+#ifndef ASTYLE_LIB
+	// a request cannot change the options of the whole process
+	if (isProcessOption(arg))
+	{
+		if (isRequest)
+		{
+			isOptionError(arg, errorInfo);
+			return;
+		}
+	}
+	else
+		requestOptions.append("--").append(arg).append(1, '\n');
+#endif
 	if ( isOption(arg, "style=allman") || isOption(arg, "style=bsd") || isOption(arg, "style=break") )
 	{
 		formatter.setFormattingStyle(STYLE_ALLMAN);
@@ -2847,6 +4812,10 @@ void ASOptions::parseOption(const string &arg, const string &errorInfo)
 	{
 		formatter.setSingleStatementsMode(false);
 	}
+	else if ( isOption(arg, "xI", "indent-only") )
+	{
+		formatter.setIndentOnlyMode(true);
+	}
 	else if ( isOption(arg, "P", "pad-paren") )
 	{
 		formatter.setParensOutsidePaddingMode(true);
@@ -3097,53 +5066,69 @@ void ASOptions::parseOption(const string &arg, const string &errorInfo)
 	// Options used by only console ///////////////////////////////////////////////////////////////////////////////////
 	else if ( isOption(arg, "n", "suffix=none") )
 	{
-		g_console->setNoBackup(true);
+		console.setNoBackup(true);
 	}
 	else if ( isParamOption(arg, "suffix=") )
 	{
 		string suffixParam = getParam(arg, "suffix=");
 		if (suffixParam.length() > 0)
 		{
-			g_console->setOrigSuffix(suffixParam);
+			console.setOrigSuffix(suffixParam);
 		}
 	}
 	else if ( isParamOption(arg, "exclude=") )
 	{
 		string suffixParam = getParam(arg, "exclude=");
 		if (suffixParam.length() > 0)
-			g_console->updateExcludeVector(suffixParam);
+			console.updateExcludeVector(suffixParam);
+	}
+	else if ( isParamOption(arg, "ignore-file=") )
+	{
+		string ignoreParam = getParam(arg, "ignore-file=");
+		if (ignoreParam.length() > 0)
+			console.setIgnoreFileName(ignoreParam);
 	}
 	else if ( isOption(arg, "r", "R") || isOption(arg, "recursive") )
 	{
-		g_console->setIsRecursive(true);
+		console.setIsRecursive(true);
 	}
 	else if (isOption(arg, "dry-run"))
 	{
-		g_console->setIsDryRun(true);
+		console.setIsDryRun(true);
+	}
+	else if (isOption(arg, "profile"))
+	{
+		console.setIsProfile(true);
+	}
+	else if ( isParamOption(arg, "trace=") )
+	{
+		string traceParam = getParam(arg, "trace=");
+		if (traceParam.length() > 0)
+			console.setTraceFileName(traceParam);
 	}
 	else if ( isOption(arg, "Z", "preserve-date") )
 	{
-		g_console->setPreserveDate(true);
+		console.setPreserveDate(true);
 	}
 	else if ( isOption(arg, "v", "verbose") )
 	{
-		g_console->setIsVerbose(true);
+		console.setIsVerbose(true);
 	}
 	else if ( isOption(arg, "Q", "formatted") )
 	{
-		g_console->setIsFormattedOnly(true);
+		console.setIsFormattedOnly(true);
 	}
 	else if ( isOption(arg, "q", "quiet") )
 	{
-		g_console->setIsQuiet(true);
+		console.setIsQuiet(true);
 	}
 	else if ( isOption(arg, "i", "ignore-exclude-errors") )
 	{
-		g_console->setIgnoreExcludeErrors(true);
+		console.setIgnoreExcludeErrors(true);
 	}
 	else if ( isOption(arg, "xi", "ignore-exclude-errors-x") )
 	{
-		g_console->setIgnoreExcludeErrorsAndDisplay(true);
+		console.setIgnoreExcludeErrorsAndDisplay(true);
 	}
 	else if ( isOption(arg, "X", "errors-to-stdout") )
 	{
@@ -3181,6 +5166,35 @@ void ASOptions::parseOption(const string &arg, const string &errorInfo)
 #endif
 }	// End of parseOption function
 
+#ifndef ASTYLE_LIB
+
+// get the options that are sent in a request, separated by new-lines
+// the options for the whole process are not included
+string ASOptions::getRequestOptions() const
+{
+	return requestOptions;
+}
+
+// check for an option that changes the whole console process
+// these options cannot be used in a server or batch request
+bool ASOptions::isProcessOption(const string &arg)
+{
+	return (isParamOption(arg, "exclude=")
+	        || isParamOption(arg, "ignore-file=")
+	        || isOption(arg, "r", "R")
+	        || isOption(arg, "recursive")
+	        || isOption(arg, "profile")
+	        || isParamOption(arg, "trace=")
+	        || isOption(arg, "v", "verbose")
+	        || isOption(arg, "Q", "formatted")
+	        || isOption(arg, "q", "quiet")
+	        || isOption(arg, "i", "ignore-exclude-errors")
+	        || isOption(arg, "xi", "ignore-exclude-errors-x")
+	        || isOption(arg, "X", "errors-to-stdout"));
+}
+
+#endif	// ASTYLE_LIB
+
 // Parse options from the options file.
 void ASOptions::importOptions(istream &in, vector<string> &optionsVector)
 {
@@ -3451,7 +5465,7 @@ size_t Utf8_16::Utf16ToUtf8(char* utf16In, size_t inLen, bool isBigEndian,
 	ubyte* pCur = reinterpret_cast<ubyte*>(utf8Out);
 	const ubyte* pEnd = pRead + inLen;
 	const ubyte* pCurStart = pCur;
-	static eState state = eStart;	// state is retained for subsequent blocks
+	eState &state = utf16State;		// state is retained for subsequent blocks
 	if (firstBlock)
 		state = eStart;
 
@@ -3541,6 +5555,95 @@ size_t Utf8_16::Utf16ToUtf8(char* utf16In, size_t inLen, bool isBigEndian,
 
 using namespace astyle;
 
+//----------------------------------------------------------------------------
+// operator new and delete for allocation stats builds
+//----------------------------------------------------------------------------
+
+#ifdef ASTYLE_ALLOC_STATS
+
+// the size of an allocation is saved in a header before the returned memory
+// the header size keeps the alignment of malloc
+// the allocations are counted by ASProfiler
+const size_t ALLOC_HEADER_SIZE = 16;
+
+static void* allocateCounted(size_t size)
+{
+	char* block = static_cast<char*>(malloc(size + ALLOC_HEADER_SIZE));
+	if (block == NULL)
+		return NULL;
+	*reinterpret_cast<size_t*>(block) = size;
+	ASProfiler::addAllocation(size);
+	return block + ALLOC_HEADER_SIZE;
+}
+
+static void deleteCounted(void* memory)
+{
+	if (memory == NULL)
+		return;
+	char* block = static_cast<char*>(memory) - ALLOC_HEADER_SIZE;
+	ASProfiler::removeAllocation(*reinterpret_cast<size_t*>(block));
+	free(block);
+}
+
+// exceptions are not used, so an allocation failure aborts
+void* operator new(size_t size)
+{
+	void* memory = allocateCounted(size);
+	if (memory == NULL)
+		abort();
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t &)
+{
+	return allocateCounted(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t &)
+{
+	return allocateCounted(size);
+}
+
+void operator delete(void* memory)
+{
+	deleteCounted(memory);
+}
+
+void operator delete[](void* memory)
+{
+	deleteCounted(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t &)
+{
+	deleteCounted(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t &)
+{
+	deleteCounted(memory);
+}
+
+// C++14 compilers may call the sized versions
+#if __cplusplus >= 201402L
+void operator delete(void* memory, size_t)
+{
+	deleteCounted(memory);
+}
+
+void operator delete[](void* memory, size_t)
+{
+	deleteCounted(memory);
+}
+#endif
+
+#endif	// ASTYLE_ALLOC_STATS
+
 //----------------------------------------------------------------------------
 // ASTYLE_JNI functions for Java library builds
 //----------------------------------------------------------------------------
@@ -3766,18 +5869,37 @@ int main(int argc, char** argv)
 	argvOptions = g_console->getArgvOptions(argc, argv);
 	g_console->processOptions(argvOptions);
 
+#ifndef _WIN32
+	// run the formatting server, this does not return
+	if (!g_console->getServerSocket().empty())
+		g_console->runServer();
+#endif
+
+	// format the records from cin to cout until the end of input
+	if (g_console->getIsBatch())
+	{
+		g_console->formatBatch();
+		return EXIT_SUCCESS;
+	}
+
 	// if no files have been given, use cin for input and cout for output
-	if (g_console->fileNameVectorIsEmpty())
+	if (g_console->fileNameVectorIsEmpty() && g_console->getFilesFromName().empty())
 	{
 		g_console->formatCinToCout();
+		// the check option fails if the input is not formatted
+		if (g_console->getIsCheck() && g_console->getFilesFormatted() > 0)
+			return EXIT_FAILURE;
 		return EXIT_SUCCESS;
 	}
 
 	// process entries in the fileNameVector
 	g_console->processFiles();
 
+	// the check option fails if a file is not formatted
+	bool isCheckFailed = g_console->getIsCheck() && g_console->getFilesFormatted() > 0;
+
 	delete g_console;
-	return EXIT_SUCCESS;
+	return (isCheckFailed ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 
 #endif	// ASTYLE_LIB
@@ -33,6 +33,9 @@
 
 #include "astyle.h"
 
+#include <cstdio>
+#include <deque>
+#include <map>
 #include <sstream>
 #include <ctime>
 
@@ -62,6 +65,10 @@
 	// for console build only
 	#include "ASLocalizer.h"
 	#define _(a) localizer.settext(a)
+	#ifndef _WIN32
+		// for the formatting server
+		#include <pthread.h>
+	#endif
 #endif	// ASTYLE_LIB
 
 // for G++ implementation of string.compare:
@@ -161,11 +168,14 @@ class ASStreamIterator : public ASSourceIterator
 		streamoff streamLength; // length of the input file stream
 		streamoff peekStart;    // starting position for peekNextLine
 		bool prevLineDeleted;   // the previous input line was deleted
+		int  bufferLineNumber;  // input line number of buffer
+		int  prevLineNumber;    // input line number of prevBuffer
 
 	public:	// inline functions
 		bool compareToInputBuffer(const string &nextLine_) const
 		{ return (nextLine_ == prevBuffer); }
 		const char* getOutputEOL() const { return outputEOL; }
+		int  getPrevLineNumber() const { return prevLineNumber; }
 		bool hasMoreLines() const { return !inStream->eof(); }
 };
 
@@ -185,8 +195,12 @@ class Utf8_16
 		enum { SURROGATE_TRAIL_LAST = 0xDFFF };
 		enum { SURROGATE_FIRST_VALUE = 0x10000 };
 		enum eState { eStart, eSecondOf4Bytes, ePenultimate, eFinal };
+		// Utf16ToUtf8 state is retained for subsequent blocks
+		// it is a member so separate objects may convert concurrently
+		mutable eState utf16State;
 
 	public:
+		Utf8_16() : utf16State(eStart) {}
 		bool   getBigEndian() const;
 		int    swap16bit(int value) const;
 		size_t utf16len(const utf16* utf16In) const;
@@ -202,10 +216,20 @@ class Utf8_16
 // used by both console and library builds
 //----------------------------------------------------------------------------
 
+#ifndef	ASTYLE_LIB
+class ASConsole;
+#endif
+
 class ASOptions
 {
 	public:
+#ifdef ASTYLE_LIB
 		ASOptions(ASFormatter &formatterArg) : formatter(formatterArg) {}
+#else
+		ASOptions(ASFormatter &formatterArg, ASConsole &consoleArg, bool isRequestArg = false)
+			: formatter(formatterArg), console(consoleArg), isRequest(isRequestArg) {}
+		string getRequestOptions() const;
+#endif
 		string getOptionErrors() const;
 		void importOptions(istream &in, vector<string> &optionsVector);
 		bool parseOptions(vector<string> &optionsVector, const string &errorInfo);
@@ -214,6 +238,11 @@ class ASOptions
 		// variables
 		ASFormatter &formatter;			// reference to the ASFormatter object
 		stringstream optionErrors;		// option error messages
+#ifndef	ASTYLE_LIB
+		ASConsole &console;				// reference to the ASConsole object for the console options
+		bool isRequest;					// options of a server or batch request
+		string requestOptions;			// new-line separated options that a request can use
+#endif
 
 		// functions
 		ASOptions &operator=(ASOptions &);         // not to be implemented
@@ -225,10 +254,88 @@ class ASOptions
 		bool isParamOption(const string &arg, const char* option);
 		bool isParamOption(const string &arg, const char* option1, const char* option2);
 		void parseOption(const string &arg, const string &errorInfo);
+#ifndef	ASTYLE_LIB
+		bool isProcessOption(const string &arg);
+#endif
 };
 
 #ifndef	ASTYLE_LIB
 
+//----------------------------------------------------------------------------
+// ASRecordIO class for length-prefixed records
+// used by the console build formatting server and client
+// each field is a decimal byte count and a newline followed by the data
+//----------------------------------------------------------------------------
+
+class ASRecordIO
+{
+	public:
+		ASRecordIO(FILE* inArg, FILE* outArg) : in(inArg), out(outArg), isBadInput(false) {}
+		void close();
+		bool flush();
+		bool getIsBadInput() const { return isBadInput; }
+		bool readField(string &field);
+		bool writeField(const string &field);
+
+	private:
+		ASRecordIO(const ASRecordIO &copy);         // not to be implemented
+		ASRecordIO &operator=(ASRecordIO &);        // not to be implemented
+		FILE* in;               // input stream of records
+		FILE* out;              // output stream of records
+		bool  isBadInput;       // the input is not a valid record
+};
+
+//----------------------------------------------------------------------------
+// ASWildcard class for the console build directory search
+// a wildcard compiled once for matching many file names
+//----------------------------------------------------------------------------
+
+class ASWildcard
+{
+	public:
+		ASWildcard(const string &wildcard);
+		bool matches(const char* data) const;
+
+	private:
+		bool matchesText(const char* data, const string &text) const;
+		bool hasStar;                       // the wildcard has a '*'
+		string head;                        // text before the first '*'
+		string tail;                        // text after the last '*'
+		vector<string> middle;              // text between the other '*'
+		size_t minLength;                   // minimum length of a match
+};
+
+//----------------------------------------------------------------------------
+// ASIgnoreRules class for the console build ignore-file= option
+// the compiled patterns of an ignore file for one directory level
+// the patterns have the same form as a .gitignore file
+//----------------------------------------------------------------------------
+
+class ASIgnoreRules
+{
+	private:
+		// a pattern of the ignore file
+		struct IgnoreRule
+		{
+			string pattern;                 // pattern without the '!' and the leading and trailing '/'
+			bool isNegated;                 // a match is not ignored
+			bool isDirOnly;                 // matches only directories
+			bool isAnchored;                // matches the path relative to the ignore file directory
+		};
+
+	public:
+		ASIgnoreRules() : parent(NULL) {}
+		bool isIgnored(const string &path, bool isDirectory) const;
+		bool readIgnoreFile(const string &directoryArg, const string &fileName,
+		                    const ASIgnoreRules* parentArg);
+
+	private:
+		bool matchesPattern(const char* pattern, const char* data) const;
+		const ASIgnoreRules* parent;        // rules of the parent directories, or NULL
+		string directory;                   // directory of the ignore file
+		vector<IgnoreRule> rules;           // rules in the order of the ignore file
+};
+
 //----------------------------------------------------------------------------
 // ASConsole class for console build
 //----------------------------------------------------------------------------
@@ -241,6 +348,7 @@ class ASConsole
 		// command line options
 		bool isRecursive;                   // recursive option
 		bool isDryRun;                      // dry-run option
+		bool isProfile;                     // profile option
 		bool noBackup;                      // suffix=none option
 		bool preserveDate;                  // preserve-date option
 		bool isVerbose;                     // verbose option
@@ -250,6 +358,10 @@ class ASConsole
 		bool ignoreExcludeErrorsDisplay;    // don't display unmatched excludes
 		bool optionsFileRequired;           // options= option
 		bool useAscii;                      // ascii option
+		bool isBatch;                       // batch option
+		bool isCheck;                       // check option
+		bool isCheckFailFast;               // check=fail-fast option
+		bool filesFromNull;                 // null option for the files-from= list
 		// other variables
 		bool bypassBrowserOpen;             // don't open the browser on html options
 		bool hasWildcard;                   // file name includes a wildcard
@@ -259,6 +371,13 @@ class ASConsole
 		int  filesUnchanged;                // number of files unchanged
 		bool lineEndsMixed;                 // output has mixed line ends
 		int  linesOut;                      // number of output lines
+		int  dirsOpened;                    // directories opened by the directory search
+		int  statCalls;                     // file status calls by the directory search
+		double bytesRead;                   // bytes of text read from the files formatted
+		double bytesWritten;                // bytes of text written to the files formatted
+		double readTime;                    // wall clock seconds reading files
+		double formatTime;                  // wall clock seconds formatting files
+		double writeTime;                   // wall clock seconds writing files
 		char outputEOL[4];                  // current line end
 		char prevEOL[4];                    // previous line end
 
@@ -266,21 +385,45 @@ class ASConsole
 
 		string optionsFileName;             // file path and name of the options file to use
 		string origSuffix;                  // suffix= option
+		string serverSocket;                // server= option
+		string clientSocket;                // client= option
+		string filesFromName;               // files-from= option
+		string ignoreFileName;              // ignore-file= option
+		string traceFileName;               // trace= option
 		string targetDirectory;             // path to the directory being processed
 		string targetFilename;              // file name being processed
 
 		vector<string> excludeVector;       // exclude from wildcard hits
 		vector<bool>   excludeHitsVector;   // exclude flags for error reporting
+		// a node of the exclude trie, the excludes are added from the last character
+		struct ExcludeNode
+		{
+			char ch;                        // character of the exclude
+			int  firstChild;                // index of the first child, or -1
+			int  nextSibling;               // index of the next sibling, or -1
+			int  excludeIndex;              // first excludeVector entry ending here, or -1
+		};
+		vector<ExcludeNode> excludeTrie;    // compiled excludeVector for findExclude
 		vector<string> fileNameVector;      // file paths and names from the command line
 		vector<string> optionsVector;       // options from the command line
 		vector<string> fileOptionsVector;   // options from the options file
+		string requestOptions;              // options sent in a request, set by processOptions
 		vector<string> fileName;            // files to be processed including path
+		vector<pair<double, string> > slowestFiles; // wall clock seconds and names, slowest first
+		vector<ASWildcard> wildcards;       // wildcards of the current search
+		vector<bool>   wildcardHitsVector;  // wildcard flags for error reporting
+		const ASIgnoreRules* ignoreRules;   // ignore rules of the directory being searched, or NULL
+#ifndef _WIN32
+		ASRecordIO* serverIO;               // connection to the formatting server
+#endif
 
 	public:     // variables
-		ASConsole(ASFormatter &formatterArg) : formatter(formatterArg) {
+		ASConsole(ASFormatter &formatterArg, const ASLocalizer* mainLocalizer = NULL)
+			: formatter(formatterArg), localizer(mainLocalizer) {
 			// command line options
 			isRecursive = false;
 			isDryRun = false;
+			isProfile = false;
 			noBackup = false;
 			preserveDate = false;
 			isVerbose = false;
@@ -290,6 +433,10 @@ class ASConsole
 			ignoreExcludeErrorsDisplay = false;
 			optionsFileRequired = false;
 			useAscii = false;
+			isBatch = false;
+			isCheck = false;
+			isCheckFailFast = false;
+			filesFromNull = false;
 			// other variables
 			bypassBrowserOpen = false;
 			hasWildcard = false;
@@ -302,6 +449,27 @@ class ASConsole
 			filesFormatted = 0;
 			filesUnchanged = 0;
 			linesOut = 0;
+			dirsOpened = 0;
+			statCalls = 0;
+			bytesRead = 0;
+			bytesWritten = 0;
+			readTime = 0;
+			formatTime = 0;
+			writeTime = 0;
+			ignoreRules = NULL;
+#ifndef _WIN32
+			serverIO = NULL;
+#endif
+		}
+		~ASConsole() {
+#ifndef _WIN32
+			// close the connection to the formatting server
+			if (serverIO != NULL)
+			{
+				serverIO->close();
+				delete serverIO;
+			}
+#endif
 		}
 
 	public:     // functions
@@ -309,14 +477,23 @@ class ASConsole
 		FileEncoding detectEncoding(const char* data, size_t dataSize) const;
 		void error() const;
 		void error(const char* why, const char* what) const;
+		void fileError(const char* why, const char* what, string* errorMsg) const;
+		void formatBatch();
 		void formatCinToCout();
+		bool formatStream(stringstream &in, ostringstream &out, int* diffLine = NULL);
 		vector<string> getArgvOptions(int argc, char** argv) const;
 		bool fileNameVectorIsEmpty() const;
+		int  findExclude(const string &subPath) const;
+		bool getIsBatch() const;
+		bool getIsCheck() const;
 		bool getFilesAreIdentical() const;
+		string getFilesFromName() const;
+		string getIgnoreFileName() const;
 		int  getFilesFormatted() const;
 		bool getIgnoreExcludeErrors() const;
 		bool getIgnoreExcludeErrorsDisplay() const;
 		bool getIsDryRun() const;
+		bool getIsProfile() const;
 		bool getIsFormattedOnly() const;
 		bool getIsQuiet() const;
 		bool getIsRecursive() const;
@@ -329,16 +506,22 @@ class ASConsole
 		string getNumberFormat(int num, const char* groupingArg, const char* separator) const;
 		string getOptionsFileName() const;
 		string getOrigSuffix() const;
+		string getServerSocket() const;
 		void processFiles();
 		void processOptions(vector<string> &argvOptions);
+		FileEncoding readFile(const string &fileName_, stringstream &in, string* errorMsg = NULL) const;
 		void setBypassBrowserOpen(bool state);
 		void setIgnoreExcludeErrors(bool state);
 		void setIgnoreExcludeErrorsAndDisplay(bool state);
+		void setIgnoreFileName(const string &name);
 		void setIsDryRun(bool state);
+		void setIsProfile(bool state);
+		void setTraceFileName(const string &name);
 		void setIsFormattedOnly(bool state);
 		void setIsQuiet(bool state);
 		void setIsRecursive(bool state);
 		void setIsVerbose(bool state);
+		void setLanguageMode(const string &fileName_);
 		void setNoBackup(bool state);
 		void setOptionsFileName(string name);
 		void setOrigSuffix(string suffix);
@@ -346,44 +529,190 @@ class ASConsole
 		void standardizePath(string &path, bool removeBeginningSeparator = false) const;
 		bool stringEndsWith(const string &str, const string &suffix) const;
 		void updateExcludeVector(string suffixParam);
+		static void deleteRequestConsole(ASConsole* requestConsole);
+		ASConsole* newRequestConsole(const string &options, string &errorMsg) const;
+		bool matchesWildcard(const char* name, vector<bool>* wildcardHits = NULL) const;
+		void writeFile(const string &fileName_, FileEncoding encoding, ostringstream &out,
+		               string* errorMsg = NULL) const;
 		vector<string> getExcludeVector() const;
 		vector<bool>   getExcludeHitsVector() const;
 		vector<string> getFileNameVector() const;
 		vector<string> getOptionsVector() const;
 		vector<string> getFileOptionsVector() const;
 		vector<string> getFileName() const;
+#ifndef _WIN32
+		void runServer();
+#endif
 
 	private:	// functions
 		ASConsole &operator=(ASConsole &);         // not to be implemented
+		bool checkExcludeHits() const;
+		void checkFile(const string &fileName_);
 		void correctMixedLineEnds(ostringstream &out);
 		void formatFile(const string &fileName_);
 		string getCurrentDirectory(const string &fileName_) const;
-		void getFileNames(const string &directory, const string &wildcard);
-		void getFilePaths(string &filePath);
+		void getFilePaths(const vector<string> &filePaths);
+		string getJsonString(const string &text) const;
 		string getParam(const string &arg, const char* op);
+		string getRequestOptions() const;
 		void initializeOutputEOL(LineEndFormat lineEndFormat);
+		bool isFailFastStop() const;
 		bool isOption(const string &arg, const char* op);
 		bool isOption(const string &arg, const char* op1, const char* op2);
 		bool isParamOption(const string &arg, const char* option);
 		bool isPathExclued(const string &subPath);
+		bool isSameWildcardDirectory(const string &filePath1, const string &filePath2) const;
 		void launchDefaultBrowser(const char* filePathIn = NULL) const;
 		void printHelp() const;
+		void processFilesFrom();
 		void printMsg(const char* msg, const string &data) const;
+		void printProfileFile(const ASProfiler::PhaseStats* startStats,
+		                      const ASProfiler::AllocStats &startAllocStats,
+		                      int lines, double startTime) const;
+		void printProfileStats(double startTime) const;
 		void printSeparatingLine() const;
 		void printVerboseHeader() const;
-		void printVerboseStats(clock_t startTime) const;
-		FileEncoding readFile(const string &fileName_, stringstream &in) const;
-		void removeFile(const char* fileName_, const char* errMsg) const;
-		void renameFile(const char* oldFileName, const char* newFileName, const char* errMsg) const;
+		void printVerboseStats(double startTime) const;
+		bool removeFile(const char* fileName_, const char* errMsg, string* errorMsg = NULL) const;
+		bool renameFile(const char* oldFileName, const char* newFileName, const char* errMsg,
+		                string* errorMsg = NULL) const;
 		void setOutputEOL(LineEndFormat lineEndFormat, const char* currentEOL);
 		void sleep(int seconds) const;
+		void updateSlowestFiles(const string &displayName, double seconds);
 		int  waitForRemove(const char* oldFileName) const;
-		int  wildcmp(const char* wild, const char* data) const;
-		void writeFile(const string &fileName_, FileEncoding encoding, ostringstream &out) const;
+		void writeTraceFile() const;
 #ifdef _WIN32
 		void displayLastError();
+		void getFileNames(const string &directory);
+#else
+		void connectToServer();
+		void formatCinToCoutWithServer();
+		void formatDirectoryTree(const string &directory);
+		void formatFileWithServer(const string &fileName_);
+		bool requestFromServer(const string &kind, const string &name, const string &content,
+		                       string &status, string &reply);
 #endif
 };
+
+#ifndef _WIN32
+
+//----------------------------------------------------------------------------
+// ASServer class for the console build server= option
+// formats the requests sent by client= consoles on a Unix domain socket
+// request consoles are kept for reuse for each options fingerprint
+//----------------------------------------------------------------------------
+
+class ASServer
+{
+	private:
+		// a client connection passed to connectionThread
+		struct ServerConnection
+		{
+			ASServer* server;
+			int connectionFd;
+		};
+
+	private:    // variables
+		ASConsole &console;                 // reference to the main ASConsole object
+		pthread_mutex_t cacheMutex;         // locks the formatter cache
+		pthread_mutex_t printMutex;         // locks the console messages
+		map<string, vector<ASConsole*> > idleConsoles;  // request consoles by options fingerprint
+		vector<ASConsole*> allConsoles;                 // request consoles to be deleted
+		int  requestsProcessed;             // number of requests processed
+
+	public:     // functions
+		ASServer(ASConsole &consoleArg);
+		~ASServer();
+		void run(const string &socketPath);
+
+	private:    // functions
+		ASServer(const ASServer &copy);             // not to be implemented
+		ASServer &operator=(ASServer &);            // not to be implemented
+		ASConsole* acquireConsole(const string &options, string &errorMsg);
+		void releaseConsole(const string &options, ASConsole* requestConsole);
+		bool isServerUser(int connectionFd) const;
+		void processConnection(int connectionFd);
+		bool processRequest(ASRecordIO &recordIO);
+		static void* connectionThread(void* arg);
+};
+
+//----------------------------------------------------------------------------
+// ASDirectoryWalker class for the console build recursive option
+// searches a directory tree with a pool of threads
+// each thread has a deque of directories to search and steals from the
+// other deques when its own is empty
+// the console processes the directories in sorted order as they are found
+//----------------------------------------------------------------------------
+
+class ASDirectoryWalker
+{
+	public:
+		// a directory and the results of searching it
+		struct WalkDirectory
+		{
+			string path;                        // path of the directory
+			int  state;                         // WALK_QUEUED, WALK_SEARCHING, or WALK_SEARCHED
+			size_t queueIndex;                  // deque of the directory while it is queued
+			bool isProcessed;                   // the console has processed the files
+			vector<string> files;               // sorted files to be processed
+			vector<string> excluded;            // sorted files and directories excluded
+			vector<int> excludeHits;            // indexes of the excludes matched
+			vector<bool> wildcardHits;          // flags of the wildcards matched
+			const ASIgnoreRules* parentIgnoreRules; // ignore rules of the parent directories, or NULL
+			ASIgnoreRules ignoreRules;          // ignore rules of the directory
+			vector<WalkDirectory*> subDirectories;  // sorted sub directories to be searched
+			size_t nextSubDirectory;            // next sub directory to be processed
+			size_t pendingEntries;              // entries held until processed
+			int  dirsOpened;                    // directories opened by the search
+			int  statCalls;                     // file status calls by the search
+			int  searchThread;                  // trace thread id of the search, 0 for the console
+			double searchStartTime;             // start time of the search
+			double searchEndTime;               // end time of the search
+			const char* errorMsg;               // error message if the search failed
+			int  errorNumber;                   // errno if the search failed
+		};
+
+	private:
+		enum { WALK_QUEUED, WALK_SEARCHING, WALK_SEARCHED };
+		// a thread of the pool passed to walkerThread
+		struct WalkerThread
+		{
+			ASDirectoryWalker* walker;
+			size_t queueIndex;
+		};
+
+	private:    // variables
+		const ASConsole &console;           // reference to the ASConsole object
+		string ignoreFileName;              // ignore-file= option of the console
+		bool isRecursive;                   // recursive option of the console
+		pthread_mutex_t walkMutex;          // locks the deques and the directory states
+		pthread_cond_t workCond;            // signals a directory to search or entries released
+		pthread_cond_t searchedCond;        // signals a directory has been searched
+		vector<deque<WalkDirectory*> > queues;  // directories to search, the last is the console's
+		vector<pthread_t> threads;          // the thread pool
+		vector<WalkerThread> threadArgs;    // arguments of the threads
+		size_t pendingEntries;              // entries searched and not processed
+		size_t maxPendingEntries;           // limit of the entries searched ahead
+		bool isShutdown;                    // the threads should exit
+
+	public:     // functions
+		ASDirectoryWalker(const ASConsole &consoleArg);
+		~ASDirectoryWalker();
+		void releaseDirectory(WalkDirectory* dir);
+		WalkDirectory* start(const string &directory);
+		void waitForDirectory(WalkDirectory* dir);
+
+	private:    // functions
+		ASDirectoryWalker(const ASDirectoryWalker &copy);       // not to be implemented
+		ASDirectoryWalker &operator=(ASDirectoryWalker &);      // not to be implemented
+		WalkDirectory* newDirectory(const string &path, const ASIgnoreRules* parentIgnoreRules) const;
+		void queueSubDirectories(WalkDirectory* dir, size_t queueIndex);
+		void searchDirectory(WalkDirectory* dir) const;
+		void walk(size_t queueIndex);
+		static void* walkerThread(void* arg);
+};
+
+#endif	// _WIN32
 #else	// ASTYLE_LIB
 
 //----------------------------------------------------------------------------